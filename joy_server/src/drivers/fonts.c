@@ -0,0 +1,716 @@
+// Gerado por tools/fontgen/fontgen.py a partir de external/ssd1306/font.h. Não editar.
+
+#include "fonts.h"
+
+/// Colunas de cada glifo de font_small (páginas consecutivas de `width` bytes)
+static const uint8_t font_small_data[426] = {
+    0x00, 0x00, 0x00, 0x5F, 0x07, 0x00, 0x07, 0x14, 0x7F, 0x14, 0x7F, 0x14, 0x24, 0x2A, 0x7F, 0x2A,
+    0x12, 0x23, 0x13, 0x08, 0x64, 0x62, 0x36, 0x49, 0x56, 0x20, 0x50, 0x08, 0x07, 0x03, 0x1C, 0x22,
+    0x41, 0x41, 0x22, 0x1C, 0x2A, 0x1C, 0x7F, 0x1C, 0x2A, 0x08, 0x08, 0x3E, 0x08, 0x08, 0x80, 0x70,
+    0x30, 0x08, 0x08, 0x08, 0x08, 0x08, 0x60, 0x60, 0x20, 0x10, 0x08, 0x04, 0x02, 0x3E, 0x51, 0x49,
+    0x45, 0x3E, 0x00, 0x42, 0x7F, 0x40, 0x00, 0x72, 0x49, 0x49, 0x49, 0x46, 0x21, 0x41, 0x49, 0x4D,
+    0x33, 0x18, 0x14, 0x12, 0x7F, 0x10, 0x27, 0x45, 0x45, 0x45, 0x39, 0x3C, 0x4A, 0x49, 0x49, 0x31,
+    0x41, 0x21, 0x11, 0x09, 0x07, 0x36, 0x49, 0x49, 0x49, 0x36, 0x46, 0x49, 0x49, 0x29, 0x1E, 0x14,
+    0x40, 0x34, 0x08, 0x14, 0x22, 0x41, 0x14, 0x14, 0x14, 0x14, 0x14, 0x41, 0x22, 0x14, 0x08, 0x02,
+    0x01, 0x59, 0x09, 0x06, 0x3E, 0x41, 0x5D, 0x59, 0x4E, 0x7C, 0x12, 0x11, 0x12, 0x7C, 0x7F, 0x49,
+    0x49, 0x49, 0x36, 0x3E, 0x41, 0x41, 0x41, 0x22, 0x7F, 0x41, 0x41, 0x41, 0x3E, 0x7F, 0x49, 0x49,
+    0x49, 0x41, 0x7F, 0x09, 0x09, 0x09, 0x01, 0x3E, 0x41, 0x41, 0x51, 0x73, 0x7F, 0x08, 0x08, 0x08,
+    0x7F, 0x41, 0x7F, 0x41, 0x20, 0x40, 0x41, 0x3F, 0x01, 0x7F, 0x08, 0x14, 0x22, 0x41, 0x7F, 0x40,
+    0x40, 0x40, 0x40, 0x7F, 0x02, 0x1C, 0x02, 0x7F, 0x7F, 0x04, 0x08, 0x10, 0x7F, 0x3E, 0x41, 0x41,
+    0x41, 0x3E, 0x7F, 0x09, 0x09, 0x09, 0x06, 0x3E, 0x41, 0x51, 0x21, 0x5E, 0x7F, 0x09, 0x19, 0x29,
+    0x46, 0x26, 0x49, 0x49, 0x49, 0x32, 0x03, 0x01, 0x7F, 0x01, 0x03, 0x3F, 0x40, 0x40, 0x40, 0x3F,
+    0x1F, 0x20, 0x40, 0x20, 0x1F, 0x3F, 0x40, 0x38, 0x40, 0x3F, 0x63, 0x14, 0x08, 0x14, 0x63, 0x03,
+    0x04, 0x78, 0x04, 0x03, 0x61, 0x59, 0x49, 0x4D, 0x43, 0x7F, 0x41, 0x41, 0x41, 0x02, 0x04, 0x08,
+    0x10, 0x20, 0x41, 0x41, 0x41, 0x7F, 0x04, 0x02, 0x01, 0x02, 0x04, 0x40, 0x40, 0x40, 0x40, 0x40,
+    0x03, 0x07, 0x08, 0x20, 0x54, 0x54, 0x78, 0x40, 0x7F, 0x28, 0x44, 0x44, 0x38, 0x38, 0x44, 0x44,
+    0x44, 0x28, 0x38, 0x44, 0x44, 0x28, 0x7F, 0x38, 0x54, 0x54, 0x54, 0x18, 0x08, 0x7E, 0x09, 0x02,
+    0x18, 0xA4, 0xA4, 0x9C, 0x78, 0x7F, 0x08, 0x04, 0x04, 0x78, 0x44, 0x7D, 0x40, 0x20, 0x40, 0x40,
+    0x3D, 0x7F, 0x10, 0x28, 0x44, 0x41, 0x7F, 0x40, 0x7C, 0x04, 0x78, 0x04, 0x78, 0x7C, 0x08, 0x04,
+    0x04, 0x78, 0x38, 0x44, 0x44, 0x44, 0x38, 0xFC, 0x18, 0x24, 0x24, 0x18, 0x18, 0x24, 0x24, 0x18,
+    0xFC, 0x7C, 0x08, 0x04, 0x04, 0x08, 0x48, 0x54, 0x54, 0x54, 0x24, 0x04, 0x04, 0x3F, 0x44, 0x24,
+    0x3C, 0x40, 0x40, 0x20, 0x7C, 0x1C, 0x20, 0x40, 0x20, 0x1C, 0x3C, 0x40, 0x30, 0x40, 0x3C, 0x44,
+    0x28, 0x10, 0x28, 0x44, 0x4C, 0x90, 0x90, 0x90, 0x7C, 0x44, 0x64, 0x54, 0x4C, 0x44, 0x08, 0x36,
+    0x41, 0x77, 0x41, 0x36, 0x08, 0x02, 0x01, 0x02, 0x04, 0x02,
+};
+
+/// Posição e largura de cada glifo de font_small
+static const font_glyph_t font_small_glyphs[95] = {
+    {0, 3}, // ' '
+    {3, 1}, // '!'
+    {4, 3}, // '"'
+    {7, 5}, // '#'
+    {12, 5}, // '$'
+    {17, 5}, // '%'
+    {22, 5}, // '&'
+    {27, 3}, // '''
+    {30, 3}, // '('
+    {33, 3}, // ')'
+    {36, 5}, // '*'
+    {41, 5}, // '+'
+    {46, 3}, // ','
+    {49, 5}, // '-'
+    {54, 2}, // '.'
+    {56, 5}, // '/'
+    {61, 5}, // '0'
+    {66, 5}, // '1'
+    {71, 5}, // '2'
+    {76, 5}, // '3'
+    {81, 5}, // '4'
+    {86, 5}, // '5'
+    {91, 5}, // '6'
+    {96, 5}, // '7'
+    {101, 5}, // '8'
+    {106, 5}, // '9'
+    {111, 1}, // ':'
+    {112, 2}, // ';'
+    {114, 4}, // '<'
+    {118, 5}, // '='
+    {123, 4}, // '>'
+    {127, 5}, // '?'
+    {132, 5}, // '@'
+    {137, 5}, // 'A'
+    {142, 5}, // 'B'
+    {147, 5}, // 'C'
+    {152, 5}, // 'D'
+    {157, 5}, // 'E'
+    {162, 5}, // 'F'
+    {167, 5}, // 'G'
+    {172, 5}, // 'H'
+    {177, 3}, // 'I'
+    {180, 5}, // 'J'
+    {185, 5}, // 'K'
+    {190, 5}, // 'L'
+    {195, 5}, // 'M'
+    {200, 5}, // 'N'
+    {205, 5}, // 'O'
+    {210, 5}, // 'P'
+    {215, 5}, // 'Q'
+    {220, 5}, // 'R'
+    {225, 5}, // 'S'
+    {230, 5}, // 'T'
+    {235, 5}, // 'U'
+    {240, 5}, // 'V'
+    {245, 5}, // 'W'
+    {250, 5}, // 'X'
+    {255, 5}, // 'Y'
+    {260, 5}, // 'Z'
+    {265, 4}, // '['
+    {269, 5}, // '\\'
+    {274, 4}, // ']'
+    {278, 5}, // '^'
+    {283, 5}, // '_'
+    {288, 3}, // '`'
+    {291, 5}, // 'a'
+    {296, 5}, // 'b'
+    {301, 5}, // 'c'
+    {306, 5}, // 'd'
+    {311, 5}, // 'e'
+    {316, 4}, // 'f'
+    {320, 5}, // 'g'
+    {325, 5}, // 'h'
+    {330, 3}, // 'i'
+    {333, 4}, // 'j'
+    {337, 4}, // 'k'
+    {341, 3}, // 'l'
+    {344, 5}, // 'm'
+    {349, 5}, // 'n'
+    {354, 5}, // 'o'
+    {359, 5}, // 'p'
+    {364, 5}, // 'q'
+    {369, 5}, // 'r'
+    {374, 5}, // 's'
+    {379, 5}, // 't'
+    {384, 5}, // 'u'
+    {389, 5}, // 'v'
+    {394, 5}, // 'w'
+    {399, 5}, // 'x'
+    {404, 5}, // 'y'
+    {409, 5}, // 'z'
+    {414, 3}, // '{'
+    {417, 1}, // '|'
+    {418, 3}, // '}'
+    {421, 5}, // '~'
+};
+
+const font_t font_small = {
+    .height = 8,
+    .pages = 1,
+    .spacing = 1,
+    .first = 32,
+    .last = 126,
+    .glyphs = font_small_glyphs,
+    .data = font_small_data,
+};
+
+/// Colunas de cada glifo de font_medium (páginas consecutivas de `width` bytes)
+static const uint8_t font_medium_data[1702] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x33, 0x33, 0x3F, 0x3F,
+    0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x38, 0xFF, 0xFF, 0x30, 0x30,
+    0xFF, 0xFF, 0x38, 0x30, 0x03, 0x07, 0x3F, 0x3F, 0x03, 0x03, 0x3F, 0x3F, 0x07, 0x03, 0x30, 0x78,
+    0xCC, 0xCE, 0xFF, 0xFF, 0xCE, 0xCC, 0x8C, 0x0C, 0x0C, 0x0C, 0x0C, 0x1C, 0x3F, 0x3F, 0x1C, 0x0C,
+    0x07, 0x03, 0x06, 0x0F, 0x0F, 0x86, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0C, 0x0C, 0x0E, 0x07, 0x03,
+    0x01, 0x00, 0x18, 0x3C, 0x3C, 0x18, 0x3C, 0x3E, 0xC3, 0xC3, 0x3E, 0x3C, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0x1F, 0x38, 0x30, 0x33, 0x33, 0x0C, 0x0C, 0x33, 0x33, 0xC0, 0xE0, 0x7E, 0x3F, 0x1F, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF8, 0x1C, 0x0E, 0x07, 0x03, 0x03, 0x07, 0x0E, 0x1C,
+    0x38, 0x30, 0x03, 0x07, 0x0E, 0x1C, 0xF8, 0xF0, 0x30, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0xCC, 0xCC,
+    0xE0, 0xF0, 0xFF, 0xFF, 0xF0, 0xE0, 0xCC, 0xCC, 0x0C, 0x0C, 0x01, 0x03, 0x3F, 0x3F, 0x03, 0x01,
+    0x0C, 0x0C, 0xC0, 0xC0, 0xC0, 0xE0, 0xFC, 0xFC, 0xE0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x01,
+    0x0F, 0x0F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0x7E, 0x3F,
+    0x1F, 0x06, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x3C, 0x3C, 0x18, 0x00, 0x00,
+    0x00, 0x80, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0C, 0x0C, 0x0E, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFC, 0xFE, 0x07, 0x03, 0xC3, 0xE3, 0x33, 0x33, 0xFE, 0xFC, 0x0F, 0x1F, 0x33, 0x33,
+    0x31, 0x30, 0x30, 0x38, 0x1F, 0x0F, 0x00, 0x00, 0x0C, 0x1E, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x38, 0x3F, 0x3F, 0x38, 0x30, 0x00, 0x00, 0x0C, 0x8E, 0xC7, 0xC3, 0xC3, 0xC3,
+    0xC3, 0xE7, 0x7E, 0x3C, 0x1F, 0x3F, 0x39, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x03, 0x03,
+    0x03, 0x03, 0xC3, 0xE3, 0xF3, 0x73, 0x9F, 0x0E, 0x0C, 0x1C, 0x38, 0x30, 0x30, 0x30, 0x30, 0x39,
+    0x1F, 0x0F, 0xC0, 0xE0, 0x30, 0x38, 0x0C, 0x8E, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x03, 0x03, 0x03,
+    0x03, 0x07, 0x3F, 0x3F, 0x07, 0x03, 0x1E, 0x3F, 0x33, 0x33, 0x33, 0x33, 0x33, 0x73, 0xE3, 0xC3,
+    0x0C, 0x1C, 0x38, 0x30, 0x30, 0x30, 0x30, 0x38, 0x1F, 0x0F, 0xF0, 0xF8, 0xCC, 0xCE, 0xC7, 0xC3,
+    0xC3, 0xC3, 0x83, 0x03, 0x0F, 0x1F, 0x39, 0x30, 0x30, 0x30, 0x30, 0x39, 0x1F, 0x0F, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x83, 0xC3, 0xE7, 0x7F, 0x3E, 0x30, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x01, 0x00,
+    0x00, 0x00, 0x3C, 0x3E, 0xE7, 0xC3, 0xC3, 0xC3, 0xC3, 0xE7, 0x3E, 0x3C, 0x0F, 0x1F, 0x39, 0x30,
+    0x30, 0x30, 0x30, 0x39, 0x1F, 0x0F, 0x3C, 0x7E, 0xE7, 0xC3, 0xC3, 0xC3, 0xC3, 0xE7, 0xFE, 0xFC,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x38, 0x1C, 0x0C, 0x07, 0x03, 0x30, 0x30, 0x03, 0x03, 0x00, 0x00,
+    0x30, 0x30, 0x30, 0x38, 0x1F, 0x0F, 0xC0, 0xE0, 0x30, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x00, 0x01,
+    0x03, 0x07, 0x0E, 0x1C, 0x38, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0x0E, 0x1C, 0x38, 0x30,
+    0xE0, 0xC0, 0x30, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x01, 0x00, 0x0C, 0x0E, 0x07, 0x03, 0x83, 0xC3,
+    0xC3, 0xE7, 0x7E, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x01, 0x00, 0x00, 0x00, 0xFC, 0xFE,
+    0x07, 0x03, 0xF3, 0xF3, 0xC3, 0xC7, 0xFE, 0x7C, 0x0F, 0x1F, 0x38, 0x30, 0x31, 0x33, 0x33, 0x31,
+    0x31, 0x30, 0xF0, 0xF8, 0x9C, 0x0E, 0x03, 0x03, 0x0E, 0x9C, 0xF8, 0xF0, 0x3F, 0x3F, 0x07, 0x03,
+    0x03, 0x03, 0x03, 0x07, 0x3F, 0x3F, 0xFE, 0xFF, 0xE7, 0xC3, 0xC3, 0xC3, 0xC3, 0xE7, 0x3E, 0x3C,
+    0x1F, 0x3F, 0x39, 0x30, 0x30, 0x30, 0x30, 0x39, 0x1F, 0x0F, 0xFC, 0xFE, 0x07, 0x03, 0x03, 0x03,
+    0x03, 0x07, 0x0E, 0x0C, 0x0F, 0x1F, 0x38, 0x30, 0x30, 0x30, 0x30, 0x38, 0x1C, 0x0C, 0xFE, 0xFF,
+    0x07, 0x03, 0x03, 0x03, 0x03, 0x07, 0xFE, 0xFC, 0x1F, 0x3F, 0x38, 0x30, 0x30, 0x30, 0x30, 0x38,
+    0x1F, 0x0F, 0xFE, 0xFF, 0xE7, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x03, 0x03, 0x1F, 0x3F, 0x39, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xFE, 0xFF, 0xE7, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x03, 0x03,
+    0x3F, 0x3F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFE, 0x07, 0x03, 0x03, 0x03,
+    0x03, 0x07, 0x0F, 0x0E, 0x0F, 0x1F, 0x38, 0x30, 0x30, 0x30, 0x33, 0x33, 0x3F, 0x1E, 0xFF, 0xFF,
+    0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0xFF, 0xFF, 0x3F, 0x3F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x3F, 0x3F, 0x03, 0x07, 0xFF, 0xFF, 0x07, 0x03, 0x30, 0x38, 0x3F, 0x3F, 0x38, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x07, 0xFF, 0xFF, 0x07, 0x03, 0x0C, 0x1C, 0x38, 0x30, 0x30, 0x38, 0x1F, 0x0F,
+    0x00, 0x00, 0xFF, 0xFF, 0xC0, 0xC0, 0x30, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x3F, 0x3F, 0x00, 0x00,
+    0x03, 0x07, 0x0E, 0x1C, 0x38, 0x30, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0x3F, 0x38, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xFF, 0xFF, 0x0E, 0x0C, 0xF0, 0xF0,
+    0x0C, 0x0E, 0xFF, 0xFF, 0x3F, 0x3F, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x3F, 0x3F, 0xFF, 0xFF,
+    0x38, 0x30, 0xE0, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07,
+    0x3F, 0x3F, 0xFC, 0xFE, 0x07, 0x03, 0x03, 0x03, 0x03, 0x07, 0xFE, 0xFC, 0x0F, 0x1F, 0x38, 0x30,
+    0x30, 0x30, 0x30, 0x38, 0x1F, 0x0F, 0xFE, 0xFF, 0xE7, 0xC3, 0xC3, 0xC3, 0xC3, 0xE7, 0x7E, 0x3C,
+    0x3F, 0x3F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFE, 0x07, 0x03, 0x03, 0x03,
+    0x03, 0x07, 0xFE, 0xFC, 0x0F, 0x1F, 0x38, 0x30, 0x33, 0x33, 0x0C, 0x0C, 0x33, 0x33, 0xFE, 0xFF,
+    0xE7, 0xC3, 0xC3, 0xC3, 0xC3, 0xE7, 0x7E, 0x3C, 0x3F, 0x3F, 0x00, 0x00, 0x03, 0x07, 0x0C, 0x1C,
+    0x38, 0x30, 0x3C, 0x7E, 0xE7, 0xC3, 0xC3, 0xC3, 0xC3, 0xC7, 0x8E, 0x0C, 0x0C, 0x1C, 0x38, 0x30,
+    0x30, 0x30, 0x30, 0x39, 0x1F, 0x0F, 0x0E, 0x0F, 0x03, 0x03, 0xFF, 0xFF, 0x03, 0x03, 0x0F, 0x0E,
+    0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0x0F, 0x1F, 0x38, 0x30, 0x30, 0x30, 0x30, 0x38, 0x1F, 0x0F, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x03, 0x07, 0x0E, 0x1C, 0x30, 0x30, 0x1C, 0x0E,
+    0x07, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0x0F, 0x1F, 0x30, 0x30,
+    0x0F, 0x0F, 0x30, 0x30, 0x1F, 0x0F, 0x0F, 0x1F, 0x38, 0x30, 0xC0, 0xC0, 0x30, 0x38, 0x1F, 0x0F,
+    0x3C, 0x3E, 0x07, 0x03, 0x00, 0x00, 0x03, 0x07, 0x3E, 0x3C, 0x0F, 0x1F, 0x38, 0x70, 0xC0, 0xC0,
+    0x70, 0x38, 0x1F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03,
+    0x83, 0xC3, 0xC3, 0xE3, 0xF3, 0x73, 0x1F, 0x0E, 0x1C, 0x3E, 0x33, 0x33, 0x31, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0xFE, 0xFF, 0x07, 0x03, 0x03, 0x03, 0x03, 0x03, 0x1F, 0x3F, 0x38, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x0C, 0x1C, 0x38, 0x70, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x03, 0x07, 0x0E, 0x0C, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0xFF, 0xFE, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x38, 0x3F, 0x1F, 0x30, 0x38, 0x1C, 0x0E, 0x03, 0x03, 0x0E, 0x1C, 0x38, 0x30,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x06, 0x1F,
+    0x3F, 0x7E, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30,
+    0xE0, 0xC0, 0x00, 0x00, 0x0C, 0x1E, 0x33, 0x33, 0x33, 0x33, 0x3F, 0x3F, 0x38, 0x30, 0xFF, 0xFF,
+    0xC0, 0xC0, 0x70, 0x30, 0x30, 0x70, 0xE0, 0xC0, 0x3F, 0x3F, 0x0C, 0x0C, 0x38, 0x30, 0x30, 0x38,
+    0x1F, 0x0F, 0xC0, 0xE0, 0x70, 0x30, 0x30, 0x30, 0x30, 0x70, 0xE0, 0xC0, 0x0F, 0x1F, 0x38, 0x30,
+    0x30, 0x30, 0x30, 0x38, 0x1C, 0x0C, 0xC0, 0xE0, 0x70, 0x30, 0x30, 0x70, 0xC0, 0xC0, 0xFF, 0xFF,
+    0x0F, 0x1F, 0x38, 0x30, 0x30, 0x38, 0x0C, 0x0C, 0x3F, 0x3F, 0xC0, 0xE0, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0xE0, 0xC0, 0x0F, 0x1F, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x03, 0x01, 0xC0, 0xE0,
+    0xFC, 0xFE, 0xE3, 0xC3, 0x0E, 0x0C, 0x00, 0x01, 0x3F, 0x3F, 0x01, 0x00, 0x00, 0x00, 0xC0, 0xE0,
+    0x70, 0x30, 0x30, 0x70, 0xF0, 0xE0, 0xE0, 0x80, 0x03, 0x07, 0xCE, 0xCC, 0xCC, 0xCE, 0xC1, 0xE3,
+    0x7F, 0x3F, 0xFF, 0xFF, 0xC0, 0xC0, 0x70, 0x30, 0x30, 0x70, 0xE0, 0xC0, 0x3F, 0x3F, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x30, 0x70, 0xF3, 0xE3, 0x00, 0x00, 0x30, 0x38, 0x3F, 0x3F,
+    0x38, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xF3, 0x0C, 0x1C, 0x38, 0x30, 0x30, 0x38,
+    0x1F, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0xC0, 0xE0, 0x70, 0x30, 0x3F, 0x3F, 0x03, 0x03, 0x0C, 0x1C,
+    0x38, 0x30, 0x03, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x30, 0x38, 0x3F, 0x3F, 0x38, 0x30, 0xE0, 0xF0,
+    0x30, 0x30, 0xC0, 0xC0, 0x30, 0x30, 0xE0, 0xC0, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00,
+    0x3F, 0x3F, 0xF0, 0xF0, 0xC0, 0xC0, 0x70, 0x30, 0x30, 0x70, 0xE0, 0xC0, 0x3F, 0x3F, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0xC0, 0xE0, 0x70, 0x30, 0x30, 0x30, 0x30, 0x70, 0xE0, 0xC0,
+    0x0F, 0x1F, 0x38, 0x30, 0x30, 0x30, 0x30, 0x38, 0x1F, 0x0F, 0xF0, 0xF0, 0xC0, 0x80, 0x70, 0x30,
+    0x30, 0x70, 0xE0, 0xC0, 0xFF, 0xFF, 0x03, 0x01, 0x0E, 0x0C, 0x0C, 0x0E, 0x07, 0x03, 0xC0, 0xE0,
+    0x70, 0x30, 0x30, 0x70, 0x80, 0xC0, 0xF0, 0xF0, 0x03, 0x07, 0x0E, 0x0C, 0x0C, 0x0E, 0x01, 0x03,
+    0xFF, 0xFF, 0xF0, 0xF0, 0xC0, 0xC0, 0x70, 0x30, 0x30, 0x70, 0xE0, 0xC0, 0x3F, 0x3F, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x31, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x1E, 0x0C, 0x30, 0x30, 0x30, 0x78, 0xFF, 0xFF,
+    0x78, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x1F, 0x30, 0x30, 0x1C, 0x0C, 0xF0, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0x0F, 0x1F, 0x38, 0x30, 0x30, 0x38, 0x0C, 0x0E,
+    0x3F, 0x3F, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0x03, 0x07, 0x0E, 0x1C,
+    0x30, 0x30, 0x1C, 0x0E, 0x07, 0x03, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0,
+    0x0F, 0x1F, 0x30, 0x30, 0x0F, 0x0F, 0x30, 0x30, 0x1F, 0x0F, 0x30, 0x70, 0xE0, 0xC0, 0x00, 0x00,
+    0xC0, 0xE0, 0x70, 0x30, 0x30, 0x38, 0x1C, 0x0C, 0x03, 0x03, 0x0C, 0x1C, 0x38, 0x30, 0xF0, 0xF0,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0xF0, 0xF0, 0x30, 0x71, 0xE3, 0xC3, 0xC3, 0xC3, 0xC3, 0xE7,
+    0x7F, 0x3F, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xF0, 0xF0, 0x70, 0x30, 0x30, 0x38, 0x3C, 0x3E,
+    0x33, 0x33, 0x31, 0x30, 0x30, 0x30, 0xC0, 0xE0, 0x3C, 0x3E, 0x07, 0x03, 0x00, 0x01, 0x0F, 0x1F,
+    0x38, 0x30, 0x3F, 0x3F, 0x3F, 0x3F, 0x03, 0x07, 0x3E, 0x3C, 0xE0, 0xC0, 0x30, 0x38, 0x1F, 0x0F,
+    0x01, 0x00, 0x0C, 0x0E, 0x03, 0x03, 0x0E, 0x1C, 0x30, 0x30, 0x1C, 0x0C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+/// Posição e largura de cada glifo de font_medium
+static const font_glyph_t font_medium_glyphs[95] = {
+    {0, 5}, // ' '
+    {10, 2}, // '!'
+    {14, 6}, // '"'
+    {26, 10}, // '#'
+    {46, 10}, // '$'
+    {66, 10}, // '%'
+    {86, 10}, // '&'
+    {106, 6}, // '''
+    {118, 6}, // '('
+    {130, 6}, // ')'
+    {142, 10}, // '*'
+    {162, 10}, // '+'
+    {182, 6}, // ','
+    {194, 10}, // '-'
+    {214, 4}, // '.'
+    {222, 10}, // '/'
+    {242, 10}, // '0'
+    {262, 10}, // '1'
+    {282, 10}, // '2'
+    {302, 10}, // '3'
+    {322, 10}, // '4'
+    {342, 10}, // '5'
+    {362, 10}, // '6'
+    {382, 10}, // '7'
+    {402, 10}, // '8'
+    {422, 10}, // '9'
+    {442, 2}, // ':'
+    {446, 4}, // ';'
+    {454, 8}, // '<'
+    {470, 10}, // '='
+    {490, 8}, // '>'
+    {506, 10}, // '?'
+    {526, 10}, // '@'
+    {546, 10}, // 'A'
+    {566, 10}, // 'B'
+    {586, 10}, // 'C'
+    {606, 10}, // 'D'
+    {626, 10}, // 'E'
+    {646, 10}, // 'F'
+    {666, 10}, // 'G'
+    {686, 10}, // 'H'
+    {706, 6}, // 'I'
+    {718, 10}, // 'J'
+    {738, 10}, // 'K'
+    {758, 10}, // 'L'
+    {778, 10}, // 'M'
+    {798, 10}, // 'N'
+    {818, 10}, // 'O'
+    {838, 10}, // 'P'
+    {858, 10}, // 'Q'
+    {878, 10}, // 'R'
+    {898, 10}, // 'S'
+    {918, 10}, // 'T'
+    {938, 10}, // 'U'
+    {958, 10}, // 'V'
+    {978, 10}, // 'W'
+    {998, 10}, // 'X'
+    {1018, 10}, // 'Y'
+    {1038, 10}, // 'Z'
+    {1058, 8}, // '['
+    {1074, 10}, // '\\'
+    {1094, 8}, // ']'
+    {1110, 10}, // '^'
+    {1130, 10}, // '_'
+    {1150, 6}, // '`'
+    {1162, 10}, // 'a'
+    {1182, 10}, // 'b'
+    {1202, 10}, // 'c'
+    {1222, 10}, // 'd'
+    {1242, 10}, // 'e'
+    {1262, 8}, // 'f'
+    {1278, 10}, // 'g'
+    {1298, 10}, // 'h'
+    {1318, 6}, // 'i'
+    {1330, 8}, // 'j'
+    {1346, 8}, // 'k'
+    {1362, 6}, // 'l'
+    {1374, 10}, // 'm'
+    {1394, 10}, // 'n'
+    {1414, 10}, // 'o'
+    {1434, 10}, // 'p'
+    {1454, 10}, // 'q'
+    {1474, 10}, // 'r'
+    {1494, 10}, // 's'
+    {1514, 10}, // 't'
+    {1534, 10}, // 'u'
+    {1554, 10}, // 'v'
+    {1574, 10}, // 'w'
+    {1594, 10}, // 'x'
+    {1614, 10}, // 'y'
+    {1634, 10}, // 'z'
+    {1654, 6}, // '{'
+    {1666, 2}, // '|'
+    {1670, 6}, // '}'
+    {1682, 10}, // '~'
+};
+
+const font_t font_medium = {
+    .height = 16,
+    .pages = 2,
+    .spacing = 2,
+    .first = 32,
+    .last = 126,
+    .glyphs = font_medium_glyphs,
+    .data = font_medium_data,
+};
+
+/// Colunas de cada glifo de font_large (páginas consecutivas de `width` bytes)
+static const uint8_t font_large_data[3828] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0x7F, 0x1C, 0x1C, 0x1C, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xF0, 0xFF, 0xFF, 0xFF, 0xC0,
+    0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xF0, 0xC0, 0xC0, 0x71, 0x71, 0xF1, 0xFF, 0xFF, 0xFF, 0x71, 0x71,
+    0x71, 0xFF, 0xFF, 0xFF, 0xF1, 0x71, 0x71, 0x00, 0x00, 0x01, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00,
+    0x1F, 0x1F, 0x1F, 0x01, 0x00, 0x00, 0xC0, 0xC0, 0xE0, 0x38, 0x38, 0x3C, 0xFF, 0xFF, 0xFF, 0x3C,
+    0x3C, 0x38, 0x38, 0x38, 0x38, 0x81, 0x81, 0x83, 0x8E, 0x8E, 0x8E, 0xFF, 0xFF, 0xFF, 0x8E, 0x8E,
+    0x8E, 0xF8, 0x70, 0x70, 0x03, 0x03, 0x03, 0x03, 0x07, 0x07, 0x1F, 0x1F, 0x1F, 0x07, 0x03, 0x03,
+    0x00, 0x00, 0x00, 0x0C, 0x1E, 0x3F, 0x3F, 0x1E, 0x0C, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xE0, 0x78,
+    0x38, 0x38, 0x80, 0x80, 0xC0, 0xF0, 0x70, 0x78, 0x1E, 0x0E, 0x0F, 0x03, 0x01, 0x81, 0x80, 0x00,
+    0x00, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0F, 0x1F, 0x1F, 0x0F, 0x06,
+    0xF8, 0xF8, 0xFC, 0x07, 0x07, 0x07, 0xFC, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1,
+    0xF1, 0xF1, 0x0E, 0x0E, 0x0E, 0x71, 0x71, 0x71, 0x80, 0x80, 0x80, 0x70, 0x70, 0x70, 0x03, 0x03,
+    0x07, 0x1F, 0x1E, 0x1C, 0x1C, 0x1C, 0x1C, 0x03, 0x03, 0x03, 0x1C, 0x1C, 0x1C, 0x00, 0x00, 0x80,
+    0xFC, 0xFE, 0xFF, 0x7F, 0x3E, 0x0C, 0x0E, 0x0E, 0x0F, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xE0, 0xF8, 0x38, 0x3C, 0x0F, 0x07,
+    0x07, 0x7F, 0x7F, 0xFF, 0xE0, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x07,
+    0x1E, 0x1C, 0x1C, 0x07, 0x07, 0x0F, 0x3C, 0x38, 0xF8, 0xE0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x80,
+    0x80, 0xE0, 0xFF, 0x7F, 0x7F, 0x1C, 0x1C, 0x1E, 0x07, 0x03, 0x03, 0x00, 0x00, 0x00, 0x38, 0x38,
+    0x38, 0x80, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0x80, 0x38, 0x38, 0x38, 0x8E, 0x8E, 0x8E,
+    0x3F, 0x7F, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0x3F, 0x8E, 0x8E, 0x8E, 0x03, 0x03, 0x03, 0x00,
+    0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0xF8, 0xF8, 0xF8, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x0E, 0x0E, 0x0E, 0x1F, 0x3F,
+    0xFF, 0xFF, 0xFF, 0x3F, 0x1F, 0x0E, 0x0E, 0x0E, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xF0, 0xF0, 0xE0, 0xC0, 0xE0, 0xE0, 0xF8, 0x3F, 0x1F, 0x1F,
+    0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E,
+    0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x06, 0x0F, 0x1F, 0x1F,
+    0x0F, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xE0, 0x78, 0x38,
+    0x38, 0x80, 0x80, 0xC0, 0xF0, 0x70, 0x78, 0x1E, 0x0E, 0x0F, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00,
+    0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
+    0xF8, 0xFC, 0x1F, 0x0F, 0x07, 0x07, 0x07, 0x07, 0xC7, 0xC7, 0xC7, 0xFC, 0xF8, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x70, 0x70, 0x70, 0x1E, 0x0E, 0x0F, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0x03, 0x03, 0x07,
+    0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1E, 0x1F, 0x07, 0x03, 0x03, 0x00, 0x00, 0x00, 0x38,
+    0x38, 0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x1F,
+    0x1F, 0x1F, 0x1F, 0x1F, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0x38, 0x38, 0x3C, 0x0F, 0x0F, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x0F, 0x9F, 0xFC, 0xF8, 0xF8, 0xF0, 0xF0, 0xF8, 0x3E, 0x1E, 0x0E, 0x0E, 0x0E,
+    0x0E, 0x0E, 0x0F, 0x0F, 0x03, 0x01, 0x01, 0x07, 0x0F, 0x1F, 0x1F, 0x1E, 0x1C, 0x1C, 0x1C, 0x1C,
+    0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xC7,
+    0xC7, 0xC7, 0xFF, 0x3E, 0x3C, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x0E, 0x0E, 0x0F, 0x0F, 0x17,
+    0x33, 0xFC, 0xF0, 0xF0, 0x03, 0x03, 0x07, 0x1E, 0x1E, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1E, 0x1F,
+    0x07, 0x03, 0x03, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xE0, 0x38, 0x38, 0x3C, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x1E, 0x3E, 0x7F, 0x71, 0x71, 0x71, 0x70, 0xF8, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0x70,
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1F, 0x1F, 0x1F, 0x01, 0x00, 0x00,
+    0x7C, 0xFE, 0xFF, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0xC7, 0x07, 0x07, 0x07, 0x80,
+    0x80, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x07, 0xFF, 0xFE, 0xFE, 0x03, 0x03,
+    0x07, 0x1E, 0x1E, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1E, 0x1F, 0x07, 0x03, 0x03, 0xC0, 0xC0, 0xE0,
+    0x38, 0x38, 0x3C, 0x0F, 0x0F, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xFF, 0xFF, 0xFF, 0x3E,
+    0x1E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x1E, 0x3E, 0xF8, 0xF0, 0xF0, 0x03, 0x03, 0x07, 0x1F, 0x1E,
+    0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1E, 0x1F, 0x07, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x0F, 0x9F, 0xFF, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x80, 0x80, 0xC0, 0xF0,
+    0x70, 0x78, 0x1E, 0x0E, 0x0F, 0x03, 0x01, 0x01, 0x1C, 0x1C, 0x1E, 0x07, 0x03, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0xFC, 0x9F, 0x0F, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x0F, 0x9F, 0xFC, 0xF8, 0xF8, 0xF1, 0xF1, 0xF1, 0x3F, 0x1F, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E,
+    0x1F, 0x3F, 0xF1, 0xF1, 0xF1, 0x03, 0x03, 0x07, 0x1F, 0x1E, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1E,
+    0x1F, 0x07, 0x03, 0x03, 0xF8, 0xF8, 0xFC, 0x9F, 0x0F, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0F, 0x9F,
+    0xFC, 0xF8, 0xF8, 0x01, 0x01, 0x03, 0x0F, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0x8E, 0x8F, 0x8F, 0xFF,
+    0x7F, 0x7F, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1E, 0x1E, 0x07, 0x03, 0x03, 0x00, 0x00,
+    0x00, 0xC0, 0xC0, 0xC0, 0x71, 0x71, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0,
+    0x00, 0x00, 0x00, 0xF1, 0xF1, 0xF1, 0x1C, 0x1C, 0x1F, 0x07, 0x03, 0x03, 0x00, 0x00, 0x00, 0xC0,
+    0xC0, 0xE0, 0x78, 0x38, 0x3C, 0x0F, 0x07, 0x07, 0x0E, 0x0E, 0x1F, 0x71, 0x71, 0xF1, 0xC0, 0x80,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x07, 0x1E, 0x1C, 0x1C,
+    0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x71,
+    0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x0F,
+    0x3C, 0x38, 0x78, 0xE0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xC0, 0xF1,
+    0x71, 0x71, 0x1F, 0x0E, 0x0E, 0x1C, 0x1C, 0x1E, 0x07, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x38, 0x38, 0x3C, 0x0F, 0x0F, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0F, 0x9F, 0xFC, 0xF8, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x7C, 0x7E, 0x1E, 0x0F, 0x0F, 0x03, 0x01, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF8,
+    0xFC, 0x1F, 0x0F, 0x07, 0xC7, 0xC7, 0xC7, 0x07, 0x0F, 0x1F, 0xFC, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x1F, 0x3F, 0x7F, 0x7E, 0x3E, 0x3E, 0x1F, 0x0F, 0x03, 0x03, 0x03, 0x07, 0x1F,
+    0x1E, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0xC0, 0xC0, 0xE0, 0xF8, 0x38,
+    0x3C, 0x07, 0x07, 0x07, 0x3C, 0x38, 0xF8, 0xE0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFC, 0xF8, 0x70,
+    0x70, 0x70, 0x70, 0x70, 0xF8, 0xFC, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x1F, 0x1F, 0x1F, 0xFC, 0xFE, 0xFF, 0x9F, 0x0F, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x0F, 0x9F, 0xFC, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0x3F, 0x1F, 0x0E, 0x0E, 0x0E, 0x0E,
+    0x0E, 0x1F, 0x3F, 0xF1, 0xF1, 0xF1, 0x07, 0x0F, 0x1F, 0x1F, 0x1E, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
+    0x1E, 0x1F, 0x07, 0x03, 0x03, 0xF8, 0xF8, 0xFC, 0x1F, 0x0F, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0F,
+    0x0F, 0x3C, 0x38, 0x38, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x80, 0x80, 0x03, 0x03, 0x07, 0x1F, 0x1E, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1E, 0x1E, 0x07,
+    0x03, 0x03, 0xFC, 0xFE, 0xFF, 0x1F, 0x0F, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0F, 0x1F, 0xFC, 0xF8,
+    0xF8, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0x07, 0x0F, 0x1F, 0x1F, 0x1E, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1E, 0x1F, 0x07, 0x03, 0x03, 0xFC,
+    0xFE, 0xFF, 0x9F, 0x0F, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xFF, 0xFF,
+    0xFF, 0x3F, 0x1F, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x00, 0x00, 0x00, 0x07, 0x0F, 0x1F,
+    0x1F, 0x1E, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0xFC, 0xFE, 0xFF, 0x9F,
+    0x0F, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xFF, 0xFF, 0xFF, 0x3F, 0x1F,
+    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0xFC, 0x1F, 0x0F, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x0F, 0x0F, 0x3F, 0x3E, 0x3C, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x70, 0x70, 0x70, 0xF0, 0xE0, 0xC0, 0x03, 0x03, 0x07, 0x1F, 0x1E, 0x1C, 0x1C, 0x1C, 0x1C,
+    0x1C, 0x1C, 0x1C, 0x1F, 0x0F, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x1F, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x1F,
+    0x3F, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0x1F, 0x1F, 0x07, 0x07, 0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0x07, 0x07, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1C, 0x1C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x1F, 0xFF, 0xFF, 0xFF, 0x1F, 0x07, 0x07, 0x80, 0x80, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0x03, 0x07, 0x1E,
+    0x1E, 0x1C, 0x1C, 0x1E, 0x1F, 0x07, 0x03, 0x03, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0xC0, 0xC0, 0xE0, 0x78, 0x38, 0x3C, 0x0F, 0x07, 0x07, 0xFF, 0xFF, 0xFF, 0x0E, 0x0E, 0x0E,
+    0x71, 0x71, 0xF1, 0xC0, 0x80, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x03, 0x07, 0x1E, 0x1C, 0x1C, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0F, 0x1F, 0x1F, 0x1E, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
+    0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0xFF, 0xFF, 0xFF, 0x3C, 0x38, 0x38, 0xC0, 0xC0, 0xC0, 0x38, 0x38,
+    0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x7F, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
+    0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x01, 0x01, 0x0F, 0x0E, 0x1E, 0x70, 0x70, 0xF0, 0xFF, 0xFF, 0xFF,
+    0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1F, 0x1F, 0x1F, 0xF8,
+    0xF8, 0xFC, 0x1F, 0x0F, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0F, 0x1F, 0xFC, 0xF8, 0xF8, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x03, 0x03, 0x07,
+    0x1F, 0x1E, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1E, 0x1F, 0x07, 0x03, 0x03, 0xFC, 0xFE, 0xFF, 0x9F,
+    0x0F, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0F, 0x9F, 0xFC, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0x3F, 0x1F,
+    0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0F, 0x0F, 0x03, 0x01, 0x01, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0xFC, 0x1F, 0x0F, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x0F, 0x1F, 0xFC, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x70, 0x70,
+    0x70, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x03, 0x03, 0x07, 0x1F, 0x1E, 0x1C, 0x1C, 0x1C, 0x1C,
+    0x03, 0x03, 0x03, 0x1C, 0x1C, 0x1C, 0xFC, 0xFE, 0xFF, 0x9F, 0x0F, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x0F, 0x9F, 0xFC, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0x0F, 0x0F, 0x0E, 0x7E, 0x7E, 0xFE, 0x8E, 0x8F,
+    0x8F, 0x03, 0x01, 0x01, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x07,
+    0x1E, 0x1C, 0x1C, 0xF8, 0xF8, 0xFC, 0x9F, 0x0F, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0F, 0x0F, 0x3C,
+    0x38, 0x38, 0x81, 0x81, 0x83, 0x0F, 0x0F, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x1E, 0x3E, 0xF8, 0xF0,
+    0xF0, 0x03, 0x03, 0x07, 0x1E, 0x1E, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1E, 0x1F, 0x07, 0x03, 0x03,
+    0x3C, 0x3E, 0x3F, 0x07, 0x07, 0x07, 0xFF, 0xFF, 0xFF, 0x07, 0x07, 0x07, 0x3F, 0x3E, 0x3C, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x03, 0x03, 0x07, 0x1F, 0x1E,
+    0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1E, 0x1F, 0x07, 0x03, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0xFF, 0xE0, 0x80, 0x80, 0x00,
+    0x00, 0x00, 0x80, 0x80, 0xE0, 0xFF, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x03, 0x03, 0x07, 0x1C, 0x1C,
+    0x1C, 0x07, 0x03, 0x03, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x03, 0x03, 0x07, 0x1C, 0x1C, 0x1C, 0x03, 0x03, 0x03, 0x1C, 0x1C,
+    0x1C, 0x07, 0x03, 0x03, 0x3F, 0x3F, 0x7F, 0xF0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xF0,
+    0x7F, 0x3F, 0x3F, 0x80, 0x80, 0xC0, 0xF1, 0x71, 0x71, 0x0E, 0x0E, 0x0E, 0x71, 0x71, 0xF1, 0xC0,
+    0x80, 0x80, 0x1F, 0x1F, 0x1F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1F, 0x1F,
+    0x1F, 0x3F, 0x3F, 0x7F, 0xF0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xF0, 0x7F, 0x3F, 0x3F,
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x07, 0xFE, 0xFE, 0xFE, 0x07, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xC7, 0xC7, 0xC7, 0xFF, 0x3E, 0x3C, 0x80, 0x80, 0xE0,
+    0x78, 0x7C, 0x7E, 0x1E, 0x1F, 0x0F, 0x0F, 0x07, 0x03, 0x00, 0x00, 0x00, 0x07, 0x0F, 0x1F, 0x1C,
+    0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0xFC, 0xFE, 0xFF, 0x1F, 0x0F,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x0F, 0x1F, 0x1F, 0x1E, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x38,
+    0x38, 0x78, 0xE0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x03, 0x0F, 0x0E, 0x1E, 0x78, 0x70, 0xF0, 0xC0, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x0F, 0x1F, 0xFF, 0xFE, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1E, 0x1F, 0x1F, 0x0F, 0x07,
+    0xC0, 0xC0, 0xE0, 0x78, 0x38, 0x3C, 0x07, 0x07, 0x07, 0x3C, 0x38, 0x78, 0xE0, 0xC0, 0xC0, 0x01,
+    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
+    0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x0C, 0x3E, 0x7F, 0xFF, 0xFE, 0xFC,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x0F, 0x0E, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xC0, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0xFF, 0xFE, 0xFE,
+    0x00, 0x00, 0x00, 0x03, 0x03, 0x07, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1F, 0x1F, 0x1F, 0x1F,
+    0x1C, 0x1C, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0x8E, 0x8E, 0x8E, 0x03, 0x03, 0x01, 0x01, 0x03, 0x07, 0xFF, 0xFE, 0xFE,
+    0x1F, 0x1F, 0x1F, 0x03, 0x03, 0x03, 0x1E, 0x1E, 0x1C, 0x1C, 0x1E, 0x1F, 0x07, 0x03, 0x03, 0x00,
+    0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0xFE,
+    0xFF, 0x07, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x8F, 0x8E, 0x8E, 0x03, 0x03, 0x07,
+    0x1F, 0x1E, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1E, 0x1E, 0x07, 0x03, 0x03, 0x00, 0x00, 0x00, 0xC0,
+    0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0x07, 0x03,
+    0x01, 0x01, 0x03, 0x03, 0x8E, 0x8E, 0x8E, 0xFF, 0xFF, 0xFF, 0x03, 0x03, 0x07, 0x1F, 0x1E, 0x1C,
+    0x1C, 0x1E, 0x1E, 0x03, 0x03, 0x03, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0,
+    0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFF, 0x71, 0x71, 0x71, 0x71, 0x71,
+    0x71, 0x71, 0x71, 0x71, 0x7F, 0x3E, 0x1E, 0x03, 0x03, 0x07, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
+    0x1C, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xF8, 0xF8, 0xFC, 0x87, 0x07, 0x07, 0x3C,
+    0x38, 0x38, 0x0E, 0x0E, 0x3F, 0xFF, 0xFF, 0xFF, 0x3F, 0x0E, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0,
+    0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x00, 0x00, 0x00, 0x7E, 0x7E, 0xFF, 0xE7, 0xC3, 0x81, 0x81,
+    0xC3, 0xE7, 0x1F, 0x7F, 0x7F, 0xFF, 0xFE, 0xF8, 0x00, 0x00, 0x00, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3,
+    0xE3, 0xE0, 0xF0, 0xF8, 0x3F, 0x1F, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0,
+    0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x3E, 0x0E, 0x0E, 0x03, 0x03, 0x01, 0x01,
+    0x03, 0x07, 0xFF, 0xFE, 0xFE, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1F, 0x1F, 0x1F, 0xC0, 0xC0, 0xC0, 0xC7, 0x87, 0x07, 0x00, 0x00, 0x00, 0x01, 0x01, 0x07,
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1C, 0x1C, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC7, 0xC7, 0xC7, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x03, 0x03, 0x07, 0x1E, 0x1E, 0x1C, 0x1C, 0x1E, 0x1F,
+    0x07, 0x03, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xFF,
+    0xFF, 0xFF, 0x70, 0x70, 0x70, 0x8E, 0x8E, 0x8F, 0x03, 0x01, 0x01, 0x1F, 0x1F, 0x1F, 0x00, 0x00,
+    0x00, 0x03, 0x03, 0x07, 0x1E, 0x1C, 0x1C, 0x07, 0x07, 0x1F, 0xFF, 0xFE, 0xFC, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+    0x1C, 0x1C, 0x00, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x01, 0x01, 0xFE, 0xFE, 0xFE, 0x01, 0x01, 0x01, 0xFF, 0xFE, 0xFE,
+    0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0xC0,
+    0xC0, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0x3E, 0x0E, 0x0E, 0x03, 0x03, 0x01, 0x01, 0x03, 0x07, 0xFF, 0xFE, 0xFE, 0x1F, 0x1F, 0x1F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0xC0,
+    0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFF, 0x07, 0x03,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x07, 0xFF, 0xFE, 0xFE, 0x03, 0x03, 0x07, 0x1F, 0x1E, 0x1C,
+    0x1C, 0x1C, 0x1C, 0x1C, 0x1E, 0x1F, 0x07, 0x03, 0x03, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xC0,
+    0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x7E, 0x7E, 0x18, 0xE7, 0xC3,
+    0x81, 0x81, 0xC3, 0xE7, 0xFF, 0x7E, 0x7E, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00,
+    0x00, 0x00, 0xC0, 0xC0, 0xC0, 0x7E, 0x7E, 0xFF, 0xE7, 0xC3, 0x81, 0x81, 0xC3, 0xE7, 0x18, 0x7E,
+    0x7E, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x3E, 0x0E, 0x0E, 0x03, 0x03, 0x01, 0x01, 0x03, 0x03, 0x0F, 0x0E,
+    0x0E, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x0E,
+    0x0E, 0x1F, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0xC1, 0x81, 0x81, 0x1C, 0x1C,
+    0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x07, 0x03, 0x03, 0xC0, 0xC0, 0xC0,
+    0xC0, 0xE0, 0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0x01, 0x01, 0x01, 0x01,
+    0x03, 0x07, 0xFF, 0xFF, 0xFF, 0x07, 0x03, 0x01, 0x81, 0x81, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x03, 0x07, 0x1C, 0x1C, 0x1C, 0x07, 0x03, 0x03, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x80, 0xE0, 0xFF, 0xFF, 0xFF, 0x03, 0x03, 0x07, 0x1F, 0x1E, 0x1C, 0x1C, 0x1E,
+    0x1E, 0x03, 0x03, 0x03, 0x1F, 0x1F, 0x1F, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0x7F, 0x7F, 0xFF, 0xE0, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0x80, 0xE0, 0xFF, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x03, 0x03, 0x07, 0x1C, 0x1C, 0x1C, 0x07, 0x03,
+    0x03, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0x03, 0x03, 0x07, 0x1C, 0x1C, 0x1C, 0x03, 0x03, 0x03, 0x1C, 0x1C, 0x1C, 0x07, 0x03,
+    0x03, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0,
+    0x01, 0x01, 0x03, 0x8F, 0x8E, 0x8E, 0x70, 0x70, 0x70, 0x8E, 0x8E, 0x8F, 0x03, 0x01, 0x01, 0x1C,
+    0x1C, 0x1E, 0x07, 0x03, 0x03, 0x00, 0x00, 0x00, 0x03, 0x03, 0x07, 0x1E, 0x1C, 0x1C, 0xC0, 0xC0,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0x0F, 0x0F, 0x1F,
+    0x7C, 0x78, 0x70, 0x70, 0x70, 0x70, 0x70, 0xF8, 0xFC, 0xFF, 0xFF, 0xFF, 0x1C, 0x1C, 0x3C, 0xF0,
+    0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xF9, 0x3F, 0x1F, 0x1F, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+    0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x01, 0x01, 0x01, 0x81, 0x81, 0xC1,
+    0x71, 0x71, 0x71, 0x1F, 0x0F, 0x0F, 0x03, 0x01, 0x01, 0x1C, 0x1C, 0x1E, 0x1F, 0x1F, 0x1F, 0x1C,
+    0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x00, 0x00, 0x80, 0xF8, 0xF8, 0xFC, 0x1F, 0x07,
+    0x07, 0x0E, 0x0E, 0x3F, 0xF1, 0xF1, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x07,
+    0x1F, 0x1C, 0x1C, 0xFF, 0xFF, 0xFF, 0xF1, 0xF1, 0xF1, 0x1F, 0x1F, 0x1F, 0x07, 0x07, 0x1F, 0xFC,
+    0xF8, 0xF8, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xF1, 0xF1, 0x3F, 0x0E, 0x0E, 0x1C, 0x1C,
+    0x1F, 0x07, 0x03, 0x03, 0x00, 0x00, 0x00, 0x38, 0x38, 0x3C, 0x07, 0x07, 0x07, 0x3C, 0x38, 0x78,
+    0xC0, 0xC0, 0xC0, 0x78, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+};
+
+/// Posição e largura de cada glifo de font_large
+static const font_glyph_t font_large_glyphs[95] = {
+    {0, 7}, // ' '
+    {21, 3}, // '!'
+    {30, 9}, // '"'
+    {57, 15}, // '#'
+    {102, 15}, // '$'
+    {147, 15}, // '%'
+    {192, 15}, // '&'
+    {237, 9}, // '''
+    {264, 9}, // '('
+    {291, 9}, // ')'
+    {318, 15}, // '*'
+    {363, 15}, // '+'
+    {408, 9}, // ','
+    {435, 15}, // '-'
+    {480, 6}, // '.'
+    {498, 15}, // '/'
+    {543, 15}, // '0'
+    {588, 15}, // '1'
+    {633, 15}, // '2'
+    {678, 15}, // '3'
+    {723, 15}, // '4'
+    {768, 15}, // '5'
+    {813, 15}, // '6'
+    {858, 15}, // '7'
+    {903, 15}, // '8'
+    {948, 15}, // '9'
+    {993, 3}, // ':'
+    {1002, 6}, // ';'
+    {1020, 12}, // '<'
+    {1056, 15}, // '='
+    {1101, 12}, // '>'
+    {1137, 15}, // '?'
+    {1182, 15}, // '@'
+    {1227, 15}, // 'A'
+    {1272, 15}, // 'B'
+    {1317, 15}, // 'C'
+    {1362, 15}, // 'D'
+    {1407, 15}, // 'E'
+    {1452, 15}, // 'F'
+    {1497, 15}, // 'G'
+    {1542, 15}, // 'H'
+    {1587, 9}, // 'I'
+    {1614, 15}, // 'J'
+    {1659, 15}, // 'K'
+    {1704, 15}, // 'L'
+    {1749, 15}, // 'M'
+    {1794, 15}, // 'N'
+    {1839, 15}, // 'O'
+    {1884, 15}, // 'P'
+    {1929, 15}, // 'Q'
+    {1974, 15}, // 'R'
+    {2019, 15}, // 'S'
+    {2064, 15}, // 'T'
+    {2109, 15}, // 'U'
+    {2154, 15}, // 'V'
+    {2199, 15}, // 'W'
+    {2244, 15}, // 'X'
+    {2289, 15}, // 'Y'
+    {2334, 15}, // 'Z'
+    {2379, 12}, // '['
+    {2415, 15}, // '\\'
+    {2460, 12}, // ']'
+    {2496, 15}, // '^'
+    {2541, 15}, // '_'
+    {2586, 9}, // '`'
+    {2613, 15}, // 'a'
+    {2658, 15}, // 'b'
+    {2703, 15}, // 'c'
+    {2748, 15}, // 'd'
+    {2793, 15}, // 'e'
+    {2838, 12}, // 'f'
+    {2874, 15}, // 'g'
+    {2919, 15}, // 'h'
+    {2964, 9}, // 'i'
+    {2991, 12}, // 'j'
+    {3027, 12}, // 'k'
+    {3063, 9}, // 'l'
+    {3090, 15}, // 'm'
+    {3135, 15}, // 'n'
+    {3180, 15}, // 'o'
+    {3225, 15}, // 'p'
+    {3270, 15}, // 'q'
+    {3315, 15}, // 'r'
+    {3360, 15}, // 's'
+    {3405, 15}, // 't'
+    {3450, 15}, // 'u'
+    {3495, 15}, // 'v'
+    {3540, 15}, // 'w'
+    {3585, 15}, // 'x'
+    {3630, 15}, // 'y'
+    {3675, 15}, // 'z'
+    {3720, 9}, // '{'
+    {3747, 3}, // '|'
+    {3756, 9}, // '}'
+    {3783, 15}, // '~'
+};
+
+const font_t font_large = {
+    .height = 24,
+    .pages = 3,
+    .spacing = 3,
+    .first = 32,
+    .last = 126,
+    .glyphs = font_large_glyphs,
+    .data = font_large_data,
+};
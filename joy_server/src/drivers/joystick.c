@@ -0,0 +1,272 @@
+#include "joystick.h"
+#include "storage.h"
+
+#include <stdio.h>
+
+/// Versão do formato do registro de calibração na flash
+#define JOYSTICK_CAL_VERSION 1
+
+/// Amostras usadas para medir o centro
+#define JOYSTICK_CENTER_SAMPLES 128
+
+/// Multiplicador aplicado ao ruído medido em repouso para obter a zona morta
+#define JOYSTICK_DEAD_ZONE_NOISE_FACTOR 3
+
+/// Menor zona morta aceita (folga mecânica do retorno ao centro)
+#define JOYSTICK_MIN_DEAD_ZONE 160
+
+/// Menor excursão (além da zona morta) aceita na varredura dos extremos
+#define JOYSTICK_MIN_SPAN 512
+
+/// Bits fracionários do recíproco usado na normalização
+#define JOYSTICK_SCALE_SHIFT 12
+
+/// Maior leitura do ADC de 12 bits
+#define JOYSTICK_ADC_MAX 4095
+
+/**
+ * @brief Registro de calibração gravado na flash.
+ */
+typedef struct
+{
+    uint16_t version;                              ///< JOYSTICK_CAL_VERSION
+    uint16_t reserved;                             ///< Alinhamento
+    joystick_axis_cal_t axes[JOYSTICK_AXIS_COUNT]; ///< Calibração de cada eixo
+} joystick_cal_record_t;
+
+/**
+ * @brief Estado de normalização de um eixo, derivado da calibração.
+ */
+typedef struct
+{
+    joystick_axis_cal_t cal; ///< Calibração em uso
+    uint16_t span_pos;       ///< Excursão útil acima da zona morta
+    uint16_t span_neg;       ///< Excursão útil abaixo da zona morta
+    uint32_t scale_pos;      ///< JOYSTICK_FULL_SCALE / span_pos em Q12
+    uint32_t scale_neg;      ///< JOYSTICK_FULL_SCALE / span_neg em Q12
+} joystick_axis_state_t;
+
+static joystick_axis_state_t axes[JOYSTICK_AXIS_COUNT];
+
+/// Entrada do ADC de cada eixo
+static const uint8_t axis_adc_input[JOYSTICK_AXIS_COUNT] = {1, 0};
+
+/// Calibração usada enquanto nenhuma outra estiver disponível (valores nominais)
+static const joystick_axis_cal_t default_cal = {
+    .center = 2048,
+    .min = 0,
+    .max = JOYSTICK_ADC_MAX,
+    .dead_zone = 400,
+};
+
+/**
+ * @brief Calcula o recíproco JOYSTICK_FULL_SCALE / span em Q12, arredondado para cima.
+ */
+static uint32_t joystick_scale_for_span(uint16_t span)
+{
+    if (span == 0)
+        return 0;
+    return (((uint32_t)JOYSTICK_FULL_SCALE << JOYSTICK_SCALE_SHIFT) + span - 1) / span;
+}
+
+/**
+ * @brief Recalcula as excursões e os recíprocos de um eixo a partir da calibração.
+ *
+ * É a única divisão do módulo e só ocorre ao carregar a calibração ou quando
+ * os extremos são ampliados.
+ */
+static void joystick_update_scale(joystick_axis_state_t *state)
+{
+    const joystick_axis_cal_t *cal = &state->cal;
+    int32_t pos = (int32_t)cal->max - cal->center - cal->dead_zone;
+    int32_t neg = (int32_t)cal->center - cal->min - cal->dead_zone;
+
+    state->span_pos = pos > 0 ? (uint16_t)pos : 0;
+    state->span_neg = neg > 0 ? (uint16_t)neg : 0;
+    state->scale_pos = joystick_scale_for_span(state->span_pos);
+    state->scale_neg = joystick_scale_for_span(state->span_neg);
+}
+
+/**
+ * @brief Aplica uma calibração a um eixo.
+ */
+static void joystick_apply(joystick_axis_t axis, const joystick_axis_cal_t *cal)
+{
+    axes[axis].cal = *cal;
+    joystick_update_scale(&axes[axis]);
+}
+
+/**
+ * @brief Verifica se uma calibração é coerente antes de aplicá-la.
+ */
+static bool joystick_cal_is_valid(const joystick_axis_cal_t *cal)
+{
+    return cal->min < cal->center && cal->center < cal->max && cal->max <= JOYSTICK_ADC_MAX &&
+           cal->max - cal->center > cal->dead_zone && cal->center - cal->min > cal->dead_zone;
+}
+
+/**
+ * @brief Mede centro e ruído dos eixos com o joystick em repouso.
+ *
+ * @param cal Calibrações a serem preenchidas (centro e zona morta).
+ */
+static void joystick_measure_center(joystick_axis_cal_t cal[JOYSTICK_AXIS_COUNT])
+{
+    uint32_t sum[JOYSTICK_AXIS_COUNT] = {0};
+    uint16_t lo[JOYSTICK_AXIS_COUNT];
+    uint16_t hi[JOYSTICK_AXIS_COUNT];
+
+    for (int axis = 0; axis < JOYSTICK_AXIS_COUNT; ++axis)
+    {
+        lo[axis] = JOYSTICK_ADC_MAX;
+        hi[axis] = 0;
+    }
+
+    for (int i = 0; i < JOYSTICK_CENTER_SAMPLES; ++i)
+    {
+        for (int axis = 0; axis < JOYSTICK_AXIS_COUNT; ++axis)
+        {
+            uint16_t raw = joystick_read_raw((joystick_axis_t)axis);
+            sum[axis] += raw;
+            if (raw < lo[axis])
+                lo[axis] = raw;
+            if (raw > hi[axis])
+                hi[axis] = raw;
+        }
+        sleep_us(500);
+    }
+
+    for (int axis = 0; axis < JOYSTICK_AXIS_COUNT; ++axis)
+    {
+        uint16_t dead_zone = (hi[axis] - lo[axis]) * JOYSTICK_DEAD_ZONE_NOISE_FACTOR;
+        cal[axis].center = sum[axis] / JOYSTICK_CENTER_SAMPLES;
+        cal[axis].dead_zone = dead_zone > JOYSTICK_MIN_DEAD_ZONE ? dead_zone : JOYSTICK_MIN_DEAD_ZONE;
+    }
+}
+
+void joystick_init()
+{
+    adc_init();
+    adc_gpio_init(JOYSTICK_Y_PIN);
+    adc_gpio_init(JOYSTICK_X_PIN);
+
+    joystick_cal_record_t record;
+    if (storage_load(STORAGE_SLOT_JOYSTICK, &record, sizeof(record)) && record.version == JOYSTICK_CAL_VERSION &&
+        joystick_cal_is_valid(&record.axes[JOYSTICK_AXIS_X]) && joystick_cal_is_valid(&record.axes[JOYSTICK_AXIS_Y]))
+    {
+        for (int axis = 0; axis < JOYSTICK_AXIS_COUNT; ++axis)
+            joystick_apply((joystick_axis_t)axis, &record.axes[axis]);
+        printf("Calibração do joystick carregada da flash\n");
+        return;
+    }
+
+    // Sem calibração salva: mede o centro agora e parte de extremos estreitos,
+    // que são ampliados automaticamente em joystick_normalize.
+    joystick_axis_cal_t cal[JOYSTICK_AXIS_COUNT];
+    joystick_measure_center(cal);
+    for (int axis = 0; axis < JOYSTICK_AXIS_COUNT; ++axis)
+    {
+        uint16_t margin = cal[axis].dead_zone + JOYSTICK_MIN_SPAN;
+        cal[axis].min = cal[axis].center > margin ? cal[axis].center - margin : 0;
+        cal[axis].max = cal[axis].center + margin < JOYSTICK_ADC_MAX ? cal[axis].center + margin : JOYSTICK_ADC_MAX;
+
+        if (!joystick_cal_is_valid(&cal[axis]))
+            cal[axis] = default_cal;
+        joystick_apply((joystick_axis_t)axis, &cal[axis]);
+    }
+    printf("Joystick sem calibração salva; centro X=%u Y=%u\n",
+           cal[JOYSTICK_AXIS_X].center, cal[JOYSTICK_AXIS_Y].center);
+}
+
+bool joystick_calibrate(uint32_t sweep_ms)
+{
+    joystick_cal_record_t record = {.version = JOYSTICK_CAL_VERSION};
+    joystick_measure_center(record.axes);
+
+    for (int axis = 0; axis < JOYSTICK_AXIS_COUNT; ++axis)
+    {
+        record.axes[axis].min = record.axes[axis].center;
+        record.axes[axis].max = record.axes[axis].center;
+    }
+
+    absolute_time_t deadline = make_timeout_time_ms(sweep_ms);
+    while (!time_reached(deadline))
+    {
+        for (int axis = 0; axis < JOYSTICK_AXIS_COUNT; ++axis)
+        {
+            uint16_t raw = joystick_read_raw((joystick_axis_t)axis);
+            if (raw < record.axes[axis].min)
+                record.axes[axis].min = raw;
+            if (raw > record.axes[axis].max)
+                record.axes[axis].max = raw;
+        }
+        sleep_ms(1);
+    }
+
+    for (int axis = 0; axis < JOYSTICK_AXIS_COUNT; ++axis)
+    {
+        const joystick_axis_cal_t *cal = &record.axes[axis];
+        printf("Joystick eixo %d: centro=%u min=%u max=%u zona morta=%u\n",
+               axis, cal->center, cal->min, cal->max, cal->dead_zone);
+
+        if (!joystick_cal_is_valid(cal) || cal->max - cal->center < cal->dead_zone + JOYSTICK_MIN_SPAN ||
+            cal->center - cal->min < cal->dead_zone + JOYSTICK_MIN_SPAN)
+        {
+            printf("Calibração do joystick rejeitada (varredura incompleta)\n");
+            return false;
+        }
+    }
+
+    for (int axis = 0; axis < JOYSTICK_AXIS_COUNT; ++axis)
+        joystick_apply((joystick_axis_t)axis, &record.axes[axis]);
+
+    return storage_save(STORAGE_SLOT_JOYSTICK, &record, sizeof(record));
+}
+
+uint16_t joystick_read_raw(joystick_axis_t axis)
+{
+    adc_select_input(axis_adc_input[axis]);
+    return adc_read();
+}
+
+int16_t joystick_normalize(joystick_axis_t axis, uint16_t raw)
+{
+    joystick_axis_state_t *state = &axes[axis];
+    const joystick_axis_cal_t *cal = &state->cal;
+    int32_t delta = (int32_t)raw - cal->center;
+
+    if (delta > cal->dead_zone)
+    {
+        if (raw > cal->max)
+        {
+            // Extremo além do aprendido: amplia a calibração em RAM.
+            state->cal.max = raw;
+            joystick_update_scale(state);
+        }
+        uint32_t value = ((uint32_t)(delta - cal->dead_zone) * state->scale_pos) >> JOYSTICK_SCALE_SHIFT;
+        return value > JOYSTICK_FULL_SCALE ? JOYSTICK_FULL_SCALE : (int16_t)value;
+    }
+
+    if (delta < -(int32_t)cal->dead_zone)
+    {
+        if (raw < cal->min)
+        {
+            state->cal.min = raw;
+            joystick_update_scale(state);
+        }
+        uint32_t value = ((uint32_t)(-delta - cal->dead_zone) * state->scale_neg) >> JOYSTICK_SCALE_SHIFT;
+        return value > JOYSTICK_FULL_SCALE ? -JOYSTICK_FULL_SCALE : -(int16_t)value;
+    }
+
+    return 0;
+}
+
+int16_t joystick_read(joystick_axis_t axis)
+{
+    return joystick_normalize(axis, joystick_read_raw(axis));
+}
+
+const joystick_axis_cal_t *joystick_get_calibration(joystick_axis_t axis)
+{
+    return &axes[axis].cal;
+}
@@ -0,0 +1,112 @@
+#include "storage.h"
+
+#include <string.h>
+#include <stdio.h>
+
+#include "pico/flash.h"
+
+/// Identificador gravado no início de cada registro válido
+#define STORAGE_MAGIC 0x57524346u // "WRCF"
+
+/// Tempo máximo para obter acesso exclusivo à flash
+#define STORAGE_FLASH_TIMEOUT_MS 100
+
+/**
+ * @brief Cabeçalho gravado antes do conteúdo de cada registro.
+ */
+typedef struct
+{
+    uint32_t magic;  ///< STORAGE_MAGIC
+    uint16_t length; ///< Tamanho do conteúdo em bytes
+    uint16_t crc;    ///< CRC-16 do conteúdo
+} storage_header_t;
+
+/**
+ * @brief Parâmetros repassados para a rotina executada com a flash bloqueada.
+ */
+typedef struct
+{
+    uint32_t offset;     ///< Deslocamento do setor a partir do início da flash
+    const uint8_t *page; ///< Página a ser programada
+} storage_write_t;
+
+/**
+ * @brief Calcula o deslocamento (a partir do início da flash) do setor de um slot.
+ */
+static uint32_t storage_slot_offset(uint8_t slot)
+{
+    return PICO_FLASH_SIZE_BYTES - (uint32_t)(slot + 1) * FLASH_SECTOR_SIZE;
+}
+
+uint16_t storage_crc16(const void *data, size_t len)
+{
+    const uint8_t *bytes = (const uint8_t *)data;
+    uint16_t crc = 0xFFFF;
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        crc ^= (uint16_t)bytes[i] << 8;
+        for (uint8_t b = 0; b < 8; ++b)
+            crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+    }
+    return crc;
+}
+
+bool storage_load(uint8_t slot, void *data, size_t len)
+{
+    if (slot >= STORAGE_SLOT_COUNT || len > STORAGE_MAX_RECORD_SIZE)
+        return false;
+
+    const uint8_t *sector = (const uint8_t *)(XIP_BASE + storage_slot_offset(slot));
+    storage_header_t header;
+    memcpy(&header, sector, sizeof(header));
+
+    if (header.magic != STORAGE_MAGIC || header.length != len)
+        return false;
+
+    if (storage_crc16(sector + sizeof(header), len) != header.crc)
+        return false;
+
+    memcpy(data, sector + sizeof(header), len);
+    return true;
+}
+
+/**
+ * @brief Apaga o setor e programa a página; executada com a flash bloqueada.
+ */
+static void storage_write_locked(void *param)
+{
+    const storage_write_t *write = (const storage_write_t *)param;
+    flash_range_erase(write->offset, FLASH_SECTOR_SIZE);
+    flash_range_program(write->offset, write->page, FLASH_PAGE_SIZE);
+}
+
+bool storage_save(uint8_t slot, const void *data, size_t len)
+{
+    if (slot >= STORAGE_SLOT_COUNT || len > STORAGE_MAX_RECORD_SIZE)
+        return false;
+
+    static uint8_t page[FLASH_PAGE_SIZE];
+    memset(page, 0xFF, sizeof(page));
+
+    storage_header_t header = {
+        .magic = STORAGE_MAGIC,
+        .length = (uint16_t)len,
+        .crc = storage_crc16(data, len),
+    };
+    memcpy(page, &header, sizeof(header));
+    memcpy(page + sizeof(header), data, len);
+
+    storage_write_t write = {
+        .offset = storage_slot_offset(slot),
+        .page = page,
+    };
+
+    int err = flash_safe_execute(storage_write_locked, &write, STORAGE_FLASH_TIMEOUT_MS);
+    if (err != PICO_OK)
+    {
+        printf("Falha ao gravar slot %u na flash: %d\n", slot, err);
+        return false;
+    }
+    return true;
+}
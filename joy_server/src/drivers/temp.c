@@ -1,43 +1,124 @@
 #include "temp.h"
+#include "storage.h"
+
+#include <stdio.h>
+
+/// Tabela leitura bruta -> centésimos de grau, montada em temp_build_table()
+static int16_t temp_table[TEMP_TABLE_SIZE];
 
 /**
- * @brief Inicializa o ADC e ativa o sensor de temperatura.
+ * @brief Divisão inteira com arredondamento para o inteiro mais próximo.
  */
-void init_temp_sensor()
+static int64_t temp_div_round(int64_t num, int64_t den)
 {
-    adc_init();
-    adc_set_temp_sensor_enabled(true);
+    if (den < 0)
+    {
+        num = -num;
+        den = -den;
+    }
+    return num >= 0 ? (num + den / 2) / den : (num - den / 2) / den;
 }
 
 /**
- * @brief Realiza a leitura da temperatura interna.
+ * @brief Converte uma leitura bruta com a fórmula do datasheet, em inteiros.
  *
- * Faz a leitura bruta do ADC, converte para tensão e depois em temperatura.
+ * A fórmula utilizada é: T(°C) = 27 - (V - 0.706) / 0.001721
+ */
+static int32_t temp_nominal_centi(uint16_t raw)
+{
+    int64_t voltage_uv = temp_div_round((int64_t)raw * ADC_VREF_UV, 1 << ADC_RESOLUTION_BITS);
+    return 2700 - (int32_t)temp_div_round((voltage_uv - TEMP_SENSOR_V27_UV) * 100, TEMP_SENSOR_SLOPE_UV);
+}
+
+/**
+ * @brief Converte uma leitura bruta pela reta que passa pelos dois pontos de calibração.
+ */
+static int32_t temp_calibrated_centi(const temp_calibration_t *cal, uint16_t raw)
+{
+    int64_t num = ((int64_t)raw - cal->raw_low) * (cal->centi_high - cal->centi_low);
+    return cal->centi_low + (int32_t)temp_div_round(num, (int64_t)cal->raw_high - cal->raw_low);
+}
+
+/**
+ * @brief Pré-calcula a tabela de conversão.
  *
- * @return Temperatura em graus Celsius.
+ * @param cal Calibração a ser usada, ou NULL para a fórmula do datasheet.
  */
-float read_internal_temperature()
+static void temp_build_table(const temp_calibration_t *cal)
 {
-    adc_select_input(ADC_TEMP_CHANNEL);
-    float conversion_factor = ADC_VREF / ADC_RESOLUTION;
-    uint16_t raw = adc_read();
+    for (uint16_t i = 0; i < TEMP_TABLE_SIZE; ++i)
+    {
+        uint16_t raw = TEMP_TABLE_FIRST_RAW + i;
+        int32_t centi = cal ? temp_calibrated_centi(cal, raw) : temp_nominal_centi(raw);
+
+        if (centi > INT16_MAX)
+            centi = INT16_MAX;
+        else if (centi < INT16_MIN)
+            centi = INT16_MIN;
+        temp_table[i] = (int16_t)centi;
+    }
+}
+
+/**
+ * @brief Verifica se os pontos de calibração definem uma reta utilizável.
+ */
+static bool temp_calibration_is_valid(const temp_calibration_t *cal)
+{
+    return cal->raw_low != cal->raw_high && cal->centi_low != cal->centi_high;
+}
+
+/**
+ * @brief Inicializa o ADC, ativa o sensor de temperatura e monta a tabela de conversão.
+ */
+void init_temp_sensor()
+{
+    adc_init();
+    adc_set_temp_sensor_enabled(true);
+
+    temp_calibration_t cal;
+    if (storage_load(STORAGE_SLOT_TEMP, &cal, sizeof(cal)) && temp_calibration_is_valid(&cal))
+    {
+        temp_build_table(&cal);
+        printf("Calibração de temperatura carregada da flash\n");
+    }
+    else
+    {
+        temp_build_table(NULL);
+    }
+}
 
-    float voltage = raw * conversion_factor;
-    float temperature = voltage_to_temperature_c(voltage);
+uint16_t read_temperature_raw()
+{
+    adc_select_input(ADC_TEMP_CHANNEL);
+    return adc_read();
+}
 
-    return temperature;
+int16_t temp_raw_to_centi(uint16_t raw)
+{
+    if (raw < TEMP_TABLE_FIRST_RAW)
+        return temp_table[0];
+    if (raw >= TEMP_TABLE_FIRST_RAW + TEMP_TABLE_SIZE)
+        return temp_table[TEMP_TABLE_SIZE - 1];
+    return temp_table[raw - TEMP_TABLE_FIRST_RAW];
 }
 
 /**
- * @brief Converte tensão em temperatura com base na fórmula do datasheet.
+ * @brief Realiza a leitura da temperatura interna.
  *
- * A fórmula utilizada é: T(°C) = 27 - (V - 0.706) / 0.001721
+ * Faz a leitura bruta do ADC e a converte pela tabela pré-calculada.
  *
- * @param voltage Tensão lida no ADC.
- * @return Temperatura em graus Celsius.
+ * @return Temperatura em centésimos de grau Celsius.
  */
-float voltage_to_temperature_c(float voltage)
+int16_t read_internal_temperature_centi()
 {
-    float temperature = 27.0f - (voltage - 0.706f) / 0.001721f;
-    return temperature;
+    return temp_raw_to_centi(read_temperature_raw());
+}
+
+bool temp_set_calibration(const temp_calibration_t *cal)
+{
+    if (!temp_calibration_is_valid(cal))
+        return false;
+
+    temp_build_table(cal);
+    return storage_save(STORAGE_SLOT_TEMP, cal, sizeof(*cal));
 }
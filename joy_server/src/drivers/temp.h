@@ -2,8 +2,11 @@
  * @file temp.h
  * @brief Interface para leitura da temperatura interna do RP2040.
  *
- * Este módulo fornece funções para inicializar o sensor de temperatura interno,
- * realizar a leitura da temperatura e converter a tensão lida para graus Celsius.
+ * Este módulo fornece funções para inicializar o sensor de temperatura interno
+ * e converter leituras do ADC em centésimos de grau Celsius. A conversão usa
+ * apenas inteiros: uma tabela leitura bruta -> centigraus é pré-calculada na
+ * inicialização a partir da fórmula do datasheet ou de uma calibração de dois
+ * pontos salva na flash.
  */
 
 #ifndef TEMP_H
@@ -15,35 +18,74 @@
 /// Canal ADC utilizado para leitura da temperatura interna
 #define ADC_TEMP_CHANNEL 4
 
-/// Tensão de referência do ADC
-#define ADC_VREF 3.3f
+/// Tensão de referência do ADC, em microvolts
+#define ADC_VREF_UV 3300000
 
 /// Resolução do ADC (12 bits)
-#define ADC_RESOLUTION 4096.0f
+#define ADC_RESOLUTION_BITS 12
+
+/// Tensão do sensor a 27 °C (datasheet), em microvolts
+#define TEMP_SENSOR_V27_UV 706000
+
+/// Inclinação do sensor (datasheet), em microvolts por °C
+#define TEMP_SENSOR_SLOPE_UV 1721
+
+/// Primeira leitura bruta coberta pela tabela de conversão (~197 °C nominais)
+#define TEMP_TABLE_FIRST_RAW 512
+
+/// Quantidade de entradas da tabela (até a leitura 1535, ~-281 °C nominais)
+#define TEMP_TABLE_SIZE 1024
+
+/// Converte centésimos de grau para float; usar apenas na saída (logs, JSON, HTML)
+#define TEMP_CENTI_TO_FLOAT(c) ((float)(c) * 0.01f)
+
+/**
+ * @brief Calibração de dois pontos: duas leituras brutas com as temperaturas de referência.
+ */
+typedef struct
+{
+    uint16_t raw_low;   ///< Leitura bruta no ponto frio
+    int16_t centi_low;  ///< Temperatura de referência no ponto frio (centésimos de °C)
+    uint16_t raw_high;  ///< Leitura bruta no ponto quente
+    int16_t centi_high; ///< Temperatura de referência no ponto quente (centésimos de °C)
+} temp_calibration_t;
 
 /**
  * @brief Inicializa o sensor de temperatura interno do RP2040.
  *
- * Ativa o ADC e habilita o sensor de temperatura embutido no chip.
+ * Ativa o ADC, habilita o sensor embutido no chip e monta a tabela de
+ * conversão com a calibração salva na flash (ou com a fórmula do datasheet).
  */
 void init_temp_sensor();
 
 /**
- * @brief Lê a temperatura interna do microcontrolador.
+ * @brief Lê o canal do sensor de temperatura sem conversão.
  *
- * Realiza a leitura do canal ADC correspondente ao sensor de temperatura,
- * converte a leitura para tensão e depois para graus Celsius.
+ * @return Leitura bruta do ADC (0 a 4095).
+ */
+uint16_t read_temperature_raw();
+
+/**
+ * @brief Converte uma leitura bruta em temperatura usando a tabela pré-calculada.
+ *
+ * @param raw Leitura bruta do ADC.
+ * @return Temperatura em centésimos de grau Celsius.
+ */
+int16_t temp_raw_to_centi(uint16_t raw);
+
+/**
+ * @brief Lê a temperatura interna do microcontrolador.
  *
- * @return Temperatura em graus Celsius.
+ * @return Temperatura em centésimos de grau Celsius.
  */
-float read_internal_temperature();
+int16_t read_internal_temperature_centi();
 
 /**
- * @brief Converte a tensão obtida do ADC em temperatura (graus Celsius).
+ * @brief Aplica uma calibração de dois pontos e a salva na flash.
  *
- * @param voltage Valor de tensão lido do ADC.
- * @return Temperatura correspondente em graus Celsius.
+ * @param cal Pontos de calibração (as leituras brutas devem ser distintas).
+ * @return true se a calibração foi aceita e salva.
  */
-float voltage_to_temperature_c(float voltage);
+bool temp_set_calibration(const temp_calibration_t *cal);
 
 #endif
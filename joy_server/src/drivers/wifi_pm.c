@@ -0,0 +1,145 @@
+#include "wifi_pm.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "pico/stdlib.h"
+#include "pico/cyw43_arch.h"
+
+#include "storage.h"
+
+/**
+ * @brief Par de modos de um perfil e o tempo sem tráfego até trocar de um para o outro.
+ */
+typedef struct
+{
+    const char *name;
+    wifi_pm_mode_t busy;
+    wifi_pm_mode_t idle;
+    uint32_t hold_ms;
+} wifi_pm_profile_info_t;
+
+/**
+ * @brief Registro do perfil na flash.
+ */
+typedef struct
+{
+    uint8_t version;
+    uint8_t profile;
+} wifi_pm_record_t;
+
+static_assert(sizeof(wifi_pm_record_t) <= STORAGE_MAX_RECORD_SIZE, "wifi_pm record must fit a storage record");
+
+static const wifi_pm_profile_info_t wifi_pm_profiles[WIFI_PM_PROFILE_COUNT] = {
+    [WIFI_PM_LATENCY] = {"latencia", WIFI_PM_MODE_NONE, WIFI_PM_MODE_PERFORMANCE, 10000},
+    [WIFI_PM_BALANCED] = {"equilibrio", WIFI_PM_MODE_NONE, WIFI_PM_MODE_AGGRESSIVE, 5000},
+    [WIFI_PM_POWER] = {"economia", WIFI_PM_MODE_PERFORMANCE, WIFI_PM_MODE_PS_POLL, 1000},
+};
+
+static const uint32_t wifi_pm_values[WIFI_PM_MODE_COUNT] = {
+    [WIFI_PM_MODE_NONE] = CYW43_NONE_PM,
+    [WIFI_PM_MODE_PERFORMANCE] = CYW43_PERFORMANCE_PM,
+    [WIFI_PM_MODE_AGGRESSIVE] = CYW43_AGGRESSIVE_PM,
+    [WIFI_PM_MODE_PS_POLL] = cyw43_pm_value(CYW43_PM1_POWERSAVE_MODE, 10, 1, 1, 10),
+};
+
+static const char *wifi_pm_mode_names[WIFI_PM_MODE_COUNT] = {"sem economia", "desempenho", "agressivo", "ps-poll"};
+
+const char *wifi_pm_profile_name(wifi_pm_profile_t profile)
+{
+    return profile < WIFI_PM_PROFILE_COUNT ? wifi_pm_profiles[profile].name : "?";
+}
+
+const char *wifi_pm_mode_name(wifi_pm_mode_t mode)
+{
+    return mode < WIFI_PM_MODE_COUNT ? wifi_pm_mode_names[mode] : "?";
+}
+
+void wifi_pm_init(wifi_pm_t *pm)
+{
+    memset(pm, 0, sizeof(*pm));
+
+    wifi_pm_record_t record;
+    if (storage_load(STORAGE_SLOT_WIFI_PM, &record, sizeof(record)) && record.version == WIFI_PM_RECORD_VERSION &&
+        record.profile < WIFI_PM_PROFILE_COUNT)
+        pm->profile = (wifi_pm_profile_t)record.profile;
+    else
+        pm->profile = WIFI_PM_DEFAULT_PROFILE;
+
+    pm->busy = true; // A conexão e as primeiras trocas começam no modo de baixa latência
+    pm->mode = wifi_pm_profiles[pm->profile].busy;
+    pm->last_traffic_us = time_us_64();
+}
+
+void wifi_pm_traffic(wifi_pm_t *pm, uint64_t now_us)
+{
+    pm->last_traffic_us = now_us;
+    pm->busy = true;
+}
+
+void wifi_pm_poll(wifi_pm_t *pm, bool online, uint64_t now_us)
+{
+    if (!online)
+    { // Reaplica na próxima conexão
+        pm->applied = false;
+        return;
+    }
+
+    if (pm->applied && now_us > pm->accounted_us)
+    {
+        if (pm->busy)
+            pm->busy_us += now_us - pm->accounted_us;
+        else
+            pm->idle_us += now_us - pm->accounted_us;
+    }
+    pm->accounted_us = now_us;
+
+    const wifi_pm_profile_info_t *info = &wifi_pm_profiles[pm->profile];
+    if (pm->busy && now_us - pm->last_traffic_us >= info->hold_ms * 1000ull)
+        pm->busy = false;
+
+    wifi_pm_mode_t mode = pm->busy ? info->busy : info->idle;
+    if (pm->applied && mode == pm->mode)
+        return;
+
+    int err = cyw43_wifi_pm(&cyw43_state, wifi_pm_values[mode]);
+    if (err)
+    { // Tenta de novo no próximo poll
+        printf("Wi-Fi: erro ao aplicar economia de energia %s: %d\n", wifi_pm_mode_name(mode), err);
+        pm->errors++;
+        pm->applied = false;
+        return;
+    }
+
+    if (pm->applied)
+        pm->switches++;
+    pm->mode = mode;
+    pm->applied = true;
+    printf("Wi-Fi: economia de energia %s (%s)\n", wifi_pm_mode_name(mode), info->name);
+}
+
+uint64_t wifi_pm_next_event_us(const wifi_pm_t *pm)
+{
+    if (!pm->busy)
+        return UINT64_MAX;
+    return pm->last_traffic_us + wifi_pm_profiles[pm->profile].hold_ms * 1000ull;
+}
+
+bool wifi_pm_set_profile(wifi_pm_t *pm, const char *name)
+{
+    for (int i = 0; i < WIFI_PM_PROFILE_COUNT; ++i)
+    {
+        if (strcmp(name, wifi_pm_profiles[i].name) != 0)
+            continue;
+
+        pm->profile = (wifi_pm_profile_t)i;
+        pm->applied = false; // O modo do novo perfil vale no próximo poll
+
+        wifi_pm_record_t record = {.version = WIFI_PM_RECORD_VERSION, .profile = (uint8_t)i};
+        if (!storage_save(STORAGE_SLOT_WIFI_PM, &record, sizeof(record)))
+            printf("Erro ao gravar o perfil de energia na flash (vale até reiniciar)\n");
+        return true;
+    }
+    return false;
+}
@@ -0,0 +1,115 @@
+/**
+ * @file wifi_pm.h
+ * @brief Política de economia de energia do rádio CYW43 conforme o tráfego.
+ *
+ * Enquanto há tráfego (clientes consultando o painel, lotes sendo enviados),
+ * o rádio fica num modo de baixa latência; depois de um tempo sem tráfego,
+ * passa a um modo de economia mais profundo, em que dorme mais e responde mais
+ * devagar. O perfil escolhe o par de modos e o tempo de espera, e fica gravado
+ * na flash.
+ */
+
+#ifndef WIFI_PM_H
+#define WIFI_PM_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/// Perfil usado quando não há um perfil válido gravado na flash
+#ifndef WIFI_PM_DEFAULT_PROFILE
+#define WIFI_PM_DEFAULT_PROFILE WIFI_PM_BALANCED
+#endif
+
+/// Versão do registro do perfil na flash
+#define WIFI_PM_RECORD_VERSION 1
+
+/**
+ * @brief Modo de economia de energia do rádio (valores de cyw43_wifi_pm).
+ */
+typedef enum
+{
+    WIFI_PM_MODE_NONE,        ///< Sem economia: rádio sempre acordado
+    WIFI_PM_MODE_PERFORMANCE, ///< CYW43_PERFORMANCE_PM, o padrão do SDK
+    WIFI_PM_MODE_AGGRESSIVE,  ///< CYW43_AGGRESSIVE_PM
+    WIFI_PM_MODE_PS_POLL,     ///< PM1: dorme sempre e busca os quadros pendentes a cada beacon (menor consumo)
+    WIFI_PM_MODE_COUNT,
+} wifi_pm_mode_t;
+
+/**
+ * @brief Compromisso entre latência e consumo.
+ */
+typedef enum
+{
+    WIFI_PM_LATENCY,  ///< Sem economia com tráfego; desempenho após 10 s sem tráfego
+    WIFI_PM_BALANCED, ///< Sem economia com tráfego; agressivo após 5 s sem tráfego
+    WIFI_PM_POWER,    ///< Desempenho com tráfego; PS-Poll após 1 s sem tráfego
+    WIFI_PM_PROFILE_COUNT,
+} wifi_pm_profile_t;
+
+/**
+ * @brief Estado da política de energia.
+ */
+typedef struct
+{
+    wifi_pm_profile_t profile; ///< Perfil em uso
+    bool busy;                 ///< Houve tráfego dentro do tempo de espera do perfil
+    bool applied;              ///< `mode` foi aplicado ao rádio na conexão atual
+    wifi_pm_mode_t mode;       ///< Modo pedido ao rádio
+    uint64_t last_traffic_us;  ///< Último tráfego observado
+    uint64_t accounted_us;     ///< Até onde o tempo conectado já foi somado
+    uint32_t switches;         ///< Trocas de modo aplicadas
+    uint32_t errors;           ///< Falhas de cyw43_wifi_pm
+    uint64_t busy_us;          ///< Tempo conectado no modo com tráfego
+    uint64_t idle_us;          ///< Tempo conectado no modo sem tráfego
+} wifi_pm_t;
+
+/**
+ * @brief Inicia a política com o perfil gravado na flash (ou o padrão).
+ * @param pm Estado da política.
+ */
+void wifi_pm_init(wifi_pm_t *pm);
+
+/**
+ * @brief Registra tráfego: o rádio vai (ou fica) no modo de baixa latência.
+ * @param pm Estado da política.
+ * @param now_us Instante atual (time_us_64()).
+ */
+void wifi_pm_traffic(wifi_pm_t *pm, uint64_t now_us);
+
+/**
+ * @brief Aplica ao rádio o modo adequado ao tráfego recente.
+ *
+ * O modo é reaplicado a cada nova conexão.
+ *
+ * @param pm Estado da política.
+ * @param online Se a estação está conectada.
+ * @param now_us Instante atual (time_us_64()).
+ */
+void wifi_pm_poll(wifi_pm_t *pm, bool online, uint64_t now_us);
+
+/**
+ * @brief Instante em que o rádio deve passar ao modo sem tráfego.
+ * @param pm Estado da política.
+ * @return Instante absoluto em microssegundos, ou UINT64_MAX se já está nele.
+ */
+uint64_t wifi_pm_next_event_us(const wifi_pm_t *pm);
+
+/**
+ * @brief Troca o perfil, grava na flash e aplica na próxima chamada de wifi_pm_poll().
+ * @param pm Estado da política.
+ * @param name Nome do perfil ("latencia", "equilibrio" ou "economia").
+ * @return false se o nome é desconhecido.
+ */
+bool wifi_pm_set_profile(wifi_pm_t *pm, const char *name);
+
+/**
+ * @brief Nome de um perfil, para logs e comandos.
+ */
+const char *wifi_pm_profile_name(wifi_pm_profile_t profile);
+
+/**
+ * @brief Nome curto de um modo, para logs.
+ */
+const char *wifi_pm_mode_name(wifi_pm_mode_t mode);
+
+#endif
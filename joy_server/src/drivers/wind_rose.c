@@ -0,0 +1,111 @@
+#include "wind_rose.h"
+
+/// Iterações do CORDIC (a 14ª parcela de arco já é menor que 1 unidade angular)
+#define WIND_ROSE_CORDIC_ITERATIONS 14
+
+/// Bits extras de precisão aplicados às coordenadas durante as iterações
+#define WIND_ROSE_CORDIC_GUARD_BITS 2
+
+/// Inverso do ganho do CORDIC (0,607253) em Q12
+#define WIND_ROSE_CORDIC_GAIN_Q12 2487
+
+/// Largura de um setor da rosa em ângulo binário
+#define WIND_ROSE_SECTOR (65536 / WIND_ROSE_POINTS)
+
+/// Histerese convertida para ângulo binário
+#define WIND_ROSE_HYSTERESIS (WIND_ROSE_HYSTERESIS_DEG * 65536 / 360)
+
+/// atan(2^-i) em ângulo binário (65536 = uma volta)
+static const uint16_t cordic_atan[WIND_ROSE_CORDIC_ITERATIONS] = {
+    8192, 4836, 2555, 1297, 651, 326, 163, 81, 41, 20, 10, 5, 3, 1};
+
+static const char *const dir_names[WIND_ROSE_DIR_COUNT] = {
+    "NORTE", "NOR-NORDESTE", "NORDESTE", "LES-NORDESTE",
+    "LESTE", "LES-SUDESTE", "SUDESTE", "SUL-SUDESTE",
+    "SUL", "SUL-SUDOESTE", "SUDOESTE", "OES-SUDOESTE",
+    "OESTE", "OES-NOROESTE", "NOROESTE", "NOR-NOROESTE",
+    "CENTRO"};
+
+static const char *const dir_abbrevs[WIND_ROSE_DIR_COUNT] = {
+    "N", "NNE", "NE", "ENE", "E", "ESE", "SE", "SSE",
+    "S", "SSO", "SO", "OSO", "O", "ONO", "NO", "NNO",
+    "C"};
+
+void wind_rose_polar(int16_t x, int16_t y, wind_rose_polar_t *out)
+{
+    // Rumo de bússola = atan2(x, y): o vetor é girado até o eixo norte.
+    int32_t cx = (int32_t)y << WIND_ROSE_CORDIC_GUARD_BITS;
+    int32_t cy = (int32_t)x << WIND_ROSE_CORDIC_GUARD_BITS;
+    uint16_t angle = 0;
+
+    // O CORDIC converge apenas em ±99°; vetores no semiplano sul são girados 180° antes.
+    if (cx < 0)
+    {
+        cx = -cx;
+        cy = -cy;
+        angle = 32768;
+    }
+
+    for (int i = 0; i < WIND_ROSE_CORDIC_ITERATIONS; ++i)
+    {
+        int32_t dx = cy >> i;
+        int32_t dy = cx >> i;
+        if (cy > 0)
+        {
+            cx += dx;
+            cy -= dy;
+            angle += cordic_atan[i];
+        }
+        else
+        {
+            cx -= dx;
+            cy += dy;
+            angle -= cordic_atan[i];
+        }
+    }
+
+    uint32_t magnitude = ((uint32_t)cx * WIND_ROSE_CORDIC_GAIN_Q12) >> (12 + WIND_ROSE_CORDIC_GUARD_BITS);
+    uint32_t heading = ((uint32_t)angle * 3600 + 32768) >> 16;
+
+    out->angle = angle;
+    out->heading = heading >= 3600 ? 0 : (uint16_t)heading;
+    out->magnitude = magnitude > UINT16_MAX ? UINT16_MAX : (uint16_t)magnitude;
+}
+
+void wind_rose_init(wind_rose_t *rose)
+{
+    rose->dir = WIND_ROSE_CENTER;
+}
+
+wind_rose_dir_t wind_rose_update(wind_rose_t *rose, const wind_rose_polar_t *polar)
+{
+    if (rose->dir == WIND_ROSE_CENTER)
+    {
+        if (polar->magnitude <= WIND_ROSE_CENTER_EXIT)
+            return rose->dir;
+    }
+    else
+    {
+        if (polar->magnitude < WIND_ROSE_CENTER_ENTER)
+            return rose->dir = WIND_ROSE_CENTER;
+
+        // Distância angular (com sinal) até o meio do setor atual.
+        int16_t offset = (int16_t)(polar->angle - (uint16_t)(rose->dir * WIND_ROSE_SECTOR));
+        int32_t distance = offset < 0 ? -(int32_t)offset : offset;
+        if (distance <= WIND_ROSE_SECTOR / 2 + WIND_ROSE_HYSTERESIS)
+            return rose->dir;
+    }
+
+    uint16_t sector = (uint16_t)(polar->angle + WIND_ROSE_SECTOR / 2) / WIND_ROSE_SECTOR;
+    return rose->dir = (wind_rose_dir_t)(sector % WIND_ROSE_POINTS);
+}
+
+const char *wind_rose_name(wind_rose_dir_t dir)
+{
+    return dir < WIND_ROSE_DIR_COUNT ? dir_names[dir] : dir_names[WIND_ROSE_CENTER];
+}
+
+const char *wind_rose_abbrev(wind_rose_dir_t dir)
+{
+    return dir < WIND_ROSE_DIR_COUNT ? dir_abbrevs[dir] : dir_abbrevs[WIND_ROSE_CENTER];
+}
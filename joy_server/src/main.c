@@ -15,7 +15,11 @@
 
 #include "drivers/display.h"
 #include "drivers/wifi.h"
+#include "drivers/wifi_pm.h"
 #include "drivers/temp.h"
+#include "drivers/joystick.h"
+#include "drivers/wind_rose.h"
+#include "drivers/compass.h"
 
 /** @file main.c
  *  @brief Pico W TCP server for sensor data (joystick, buttons, temperature).
@@ -26,9 +30,6 @@
 /** @brief TCP pending connections limit (used with `tcp_listen_with_backlog`, `tcp_listen` uses default). */
 #define TCP_PENDING_CONNECTIONS_LIMIT 1
 
-/** @brief GPIO pin for Joystick (ADC0, typically Y-axis). */
-#define JOY_DIR_PIN 26
-
 /** @brief GPIO pin for Red LED (PWM). */
 #define RED_LED_PIN 13
 /** @brief GPIO pin for Blue LED (PWM). */
@@ -39,6 +40,14 @@
 /** @brief GPIO pin for Button B. */
 #define BTB 6
 
+/** @brief Retained display screen with the network status. */
+#define STATUS_SCREEN 1
+/** @brief Retained display screen with the wind rose compass. */
+#define COMPASS_SCREEN 2
+
+/** @brief Interval between UPDATE log lines (the loop runs at ~30 Hz while the compass is shown). */
+#define UPDATE_LOG_INTERVAL_MS 1000
+
 /** @brief PWM period (wrap value). */
 const uint16_t PERIOD_PWM = 255;
 /** @brief PWM clock divider. */
@@ -52,14 +61,26 @@ struct tcp_pcb *server_pcb = {0};
  */
 typedef struct
 {
-    float analog_x;    ///< Joystick X-axis value (-1.0 to 1.0).
-    float analog_y;    ///< Joystick Y-axis value (-1.0 to 1.0).
-    float temperature; ///< Internal temperature (°C).
-    uint8_t button_a;  ///< Button A state (1 if pressed).
-    uint8_t button_b;  ///< Button B state (1 if pressed).
+    int16_t analog_x;    ///< Joystick X-axis value (-JOYSTICK_FULL_SCALE to JOYSTICK_FULL_SCALE).
+    int16_t analog_y;    ///< Joystick Y-axis value (-JOYSTICK_FULL_SCALE to JOYSTICK_FULL_SCALE).
+    uint16_t heading;    ///< Joystick heading in tenths of degree (0 = north, clockwise).
+    uint16_t magnitude;  ///< Joystick deflection (same scale as the axes).
+    uint8_t direction;   ///< Wind rose point (`wind_rose_dir_t`).
+    int16_t temperature; ///< Internal temperature (hundredths of °C).
+    uint8_t button_a;    ///< Button A state (1 if pressed).
+    uint8_t button_b;    ///< Button B state (1 if pressed).
 
 } SENSOR_DATA_T;
 
+/** @brief Wind rose classification state (keeps the hysteresis between readings). */
+wind_rose_t wind_rose;
+
+/** @brief Wi-Fi connection supervisor (reconnects on its own after an outage). */
+wifi_supervisor_t wifi;
+
+/** @brief Radio power-save policy (low latency while the page is being polled, deeper sleep when idle). */
+wifi_pm_t wifi_pm;
+
 /**
  * @brief Configures PWM for Red and Blue LEDs.
  */
@@ -86,55 +107,6 @@ void setup_pwm()
     pwm_set_enabled(slice_blue, true);
 }
 
-/**
- * @brief Initializes ADC and joystick GPIO pin (ADC0).
- */
-void setup_joystick()
-{
-    adc_init();
-    adc_gpio_init(JOY_DIR_PIN); // Configures GPIO26 (ADC0)
-}
-
-/**
- * @brief Reads and normalizes joystick X-axis value (ADC1).
- * @return float Normalized X-axis value (-1.0 to 1.0).
- */
-float read_analog_x()
-{
-    adc_select_input(1); // ADC1 for X-axis
-    uint16_t raw_value = adc_read();
-    uint16_t dead_zone = 400;
-    float joy_x;
-
-    if (raw_value > (2048 + dead_zone))
-        joy_x = (float)(raw_value - 2048 - dead_zone) / (2047.0 - dead_zone);
-    else if (raw_value < (2048 - dead_zone))
-        joy_x = (float)(raw_value - 2048 + dead_zone) / (2047.0 - dead_zone);
-    else
-        joy_x = 0;
-    return joy_x;
-}
-
-/**
- * @brief Reads and normalizes joystick Y-axis value (ADC0).
- * @return float Normalized Y-axis value (-1.0 to 1.0).
- */
-float read_analog_y()
-{
-    adc_select_input(0); // ADC0 for Y-axis
-    uint16_t raw_value = adc_read();
-    uint16_t dead_zone = 400;
-    float joy_y;
-
-    if (raw_value > (2048 + dead_zone))
-        joy_y = (float)(raw_value - 2048 - dead_zone) / (2047.0 - dead_zone);
-    else if (raw_value < (2048 - dead_zone))
-        joy_y = (float)(raw_value - 2048 + dead_zone) / (2047.0 - dead_zone);
-    else
-        joy_y = 0;
-    return joy_y;
-}
-
 /**
  * @brief TCP callback: Closes connection after data is successfully sent.
  * @param arg User argument (unused).
@@ -149,43 +121,6 @@ static err_t tcp_sent_callback(void *arg, struct tcp_pcb *tpcb, u16_t len)
     return tcp_close(tpcb);
 }
 
-/**
- * @brief Determines wind rose direction from joystick X, Y.
- * @param x Joystick X value.
- * @param y Joystick Y value.
- * @return const char* Direction string (e.g., "NORTE", "CENTRO").
- */
-const char *get_wind_rose_direction(float x, float y)
-{
-    const float threshold = 0.5;
-    if (x > threshold)
-    {
-        if (y > threshold)
-            return "NORDESTE";
-        else if (y < -threshold)
-            return "SUDESTE";
-        else
-            return "LESTE";
-    }
-    else if (x < -threshold)
-    {
-        if (y > threshold)
-            return "NOROESTE";
-        else if (y < -threshold)
-            return "SUDOESTE";
-        else
-            return "OESTE";
-    }
-    else
-    {
-        if (y > threshold)
-            return "NORTE";
-        else if (y < -threshold)
-            return "SUL";
-    }
-    return "CENTRO";
-}
-
 /**
  * @brief TCP callback: Handles received client data and sends HTML response.
  * @param arg Pointer to SENSOR_DATA_T.
@@ -206,6 +141,7 @@ static err_t tcp_server_recv_fn(void *arg, struct tcp_pcb *tpcb,
         printf("P está vazio (conexão fechada pelo cliente ou erro)\n"); // Original log
         return ERR_OK;
     }
+    wifi_pm_traffic(&wifi_pm, time_us_64()); // A browser is watching: keep latency low
 
     // Assumes any received data is an HTTP GET request.
     // The request content itself is not parsed here.
@@ -232,12 +168,13 @@ static err_t tcp_server_recv_fn(void *arg, struct tcp_pcb *tpcb,
              "<p>Joystick X: %.2f</p><p>Joystick Y: %.2f</p>"
              "<p>Botão A: %d</p><p>Botão B: %d</p>"
              "<p>Temperatura: %.2f °C</p>"
-             "<p>Direção: <strong>%s</strong></p>"
+             "<p>Direção: <strong>%s</strong> (%u.%u°)</p>"
              "</div></body></html>",
-             readings->analog_x, readings->analog_y,
+             JOYSTICK_TO_FLOAT(readings->analog_x), JOYSTICK_TO_FLOAT(readings->analog_y),
              readings->button_a, readings->button_b,
-             readings->temperature, // Uses the value from SENSOR_DATA_T
-             get_wind_rose_direction(readings->analog_x, readings->analog_y));
+             TEMP_CENTI_TO_FLOAT(readings->temperature),
+             wind_rose_name(readings->direction),
+             readings->heading / 10, readings->heading % 10);
 
     int content_length = strlen(body);
     snprintf(headers, sizeof(headers),
@@ -340,6 +277,26 @@ void init_buttons()
     gpio_pull_up(BTB);
 }
 
+/**
+ * @brief Runs the joystick calibration when both buttons are held during boot.
+ * @note The stick must be left at rest while the buttons are held (center and
+ *       noise are measured first) and then swept through its whole range.
+ */
+void check_joystick_calibration()
+{
+    if (gpio_get(BTA) || gpio_get(BTB)) // Pull-up: a pressed button reads 0
+        return;
+
+    show("Calibrando...", false);
+    show("Gire o joystick", false);
+    display_flush(); // The sweep blocks the main loop: present the prompt now
+    bool saved = joystick_calibrate(JOYSTICK_CALIBRATION_SWEEP_MS);
+    clear_display(true);
+    show(saved ? "Calibrado!" : "Falha na calib.", false);
+    display_flush();
+    clear_display(true);
+}
+
 /**
  * @brief Main setup function: initializes stdio, drivers, and hardware.
  */
@@ -348,34 +305,75 @@ void setup()
     stdio_init_all();
     init_display();     // Assumes drivers/display.h
     init_wifi_sta();    // Assumes drivers/wifi.h
-    connect_to_wifi();  // Assumes drivers/wifi.h
+    wifi_supervisor_init(&wifi); // Connects in the background; the main loop keeps it up
+    wifi_pm_init(&wifi_pm);
     init_temp_sensor(); // Assumes drivers/temp.h
 
-    adc_init();                        // General ADC init
-    adc_set_temp_sensor_enabled(true); // Enable internal temperature sensor (ADC4)
-
     init_buttons();
-    setup_joystick(); // Initializes ADC for joystick
+    joystick_init(); // Initializes ADC for joystick and loads its calibration
+    check_joystick_calibration();
+    wind_rose_init(&wind_rose);
     // setup_pwm(); // Call if PWM LEDs are actively used
 }
 
+/** @brief Screen currently selected with button B. */
+static uint8_t active_screen = STATUS_SCREEN;
+
 /**
  * @brief Displays Wi-Fi connection status (intended for external display).
- * @note Relies on `show()` and `clear_display()` from `drivers/display.h`.
+ * @note The screen is retained: labels are drawn once and the IP field is
+ *       redrawn only when it changes, so an unchanged screen sends nothing.
  *       Also assumes `WIFI_SSID`, `WIFI_PASSWORD` are defined.
  */
 void show_connection_status()
 {
-    show("-=-REDE-=-=", false);
-    show(WIFI_SSID, false);
-    show(WIFI_PASSWORD, false); // Caution: Displaying password
-    char ip_msg[50];
+    static int ip_field = -1;
+
+    if (display_screen_begin(STATUS_SCREEN))
+    {
+        display_label(0, 0, "-=-REDE-=-=");
+        display_label(0, 16, WIFI_SSID);
+        display_label(0, 32, WIFI_PASSWORD); // Caution: Displaying password
+        ip_field = display_field(0, 6, SCREEN_WIDTH, &font_small, TEXT_ALIGN_LEFT);
+    }
+
     if (netif_default)
     { // Check if netif_default is valid
+        char ip_msg[50];
         snprintf(ip_msg, sizeof(ip_msg), "IP: %s", ipaddr_ntoa(&netif_default->ip_addr));
-        show(ip_msg, true);
+        display_field_set(ip_field, ip_msg);
+    }
+    display_render();
+}
+
+/**
+ * @brief Toggles the screen on a button B press and refreshes the active one.
+ * @param readings Latest readings, shown by the compass screen.
+ */
+void update_display(const SENSOR_DATA_T *readings)
+{
+    static bool last_button_b = false;
+    bool button_b = !gpio_get(BTB); // Read directly so short presses between samples still count
+
+    if (button_b && !last_button_b)
+        active_screen = active_screen == STATUS_SCREEN ? COMPASS_SCREEN : STATUS_SCREEN;
+    last_button_b = button_b;
+
+    if (active_screen == COMPASS_SCREEN)
+    {
+        compass_view_t view = {
+            .heading = readings->heading,
+            .magnitude = readings->magnitude,
+            .direction = readings->direction,
+            .button_a = readings->button_a,
+            .button_b = readings->button_b,
+        };
+        compass_show(COMPASS_SCREEN, &view);
+    }
+    else
+    {
+        show_connection_status();
     }
-    clear_display(true);
 }
 
 /**
@@ -384,22 +382,30 @@ void show_connection_status()
  */
 void update_readings(SENSOR_DATA_T *readings)
 {
-    readings->analog_x = read_analog_x();
-    readings->analog_y = read_analog_y();
+    readings->analog_x = joystick_read(JOYSTICK_AXIS_X);
+    readings->analog_y = joystick_read(JOYSTICK_AXIS_Y);
+
+    wind_rose_polar_t polar;
+    wind_rose_polar(readings->analog_x, readings->analog_y, &polar);
+    readings->heading = polar.heading;
+    readings->magnitude = polar.magnitude;
+    readings->direction = wind_rose_update(&wind_rose, &polar);
 
-    // Read internal temperature sensor (ADC4)
-    adc_select_input(4);
-    uint16_t temp_raw = adc_read();
-    float conversion_factor = 3.3f / (1 << 12); // ADC is 12-bit
-    float voltage = temp_raw * conversion_factor;
-    readings->temperature = 27.0f - (voltage - 0.706f) / 0.001721f; // Formula from datasheet
+    readings->temperature = read_internal_temperature_centi(); // Internal sensor (ADC4)
 
     readings->button_a = !gpio_get(BTA); // Inverted due to pull-up
     readings->button_b = !gpio_get(BTB); // Inverted due to pull-up
 
-    printf("UPDATE: X=%.2f Y=%.2f A=%d B=%d T=%.2f\n",
-           readings->analog_x, readings->analog_y,
-           readings->button_a, readings->button_b, readings->temperature);
+    static uint64_t next_log_us = 0;
+    uint64_t now_us = time_us_64();
+    if (now_us < next_log_us)
+        return;
+    next_log_us = now_us + UPDATE_LOG_INTERVAL_MS * 1000;
+
+    printf("UPDATE: X=%.2f Y=%.2f H=%u.%u D=%s A=%d B=%d T=%.2f\n",
+           JOYSTICK_TO_FLOAT(readings->analog_x), JOYSTICK_TO_FLOAT(readings->analog_y),
+           readings->heading / 10, readings->heading % 10, wind_rose_abbrev(readings->direction),
+           readings->button_a, readings->button_b, TEMP_CENTI_TO_FLOAT(readings->temperature));
 }
 
 /**
@@ -422,14 +428,16 @@ int main()
     while (true)
     {
         cyw43_arch_poll(); // Essential for lwIP and Wi-Fi event processing
+        wifi_supervisor_poll(&wifi, time_us_64());
+        wifi_pm_poll(&wifi_pm, wifi_supervisor_online(&wifi), time_us_64());
 
-        if (netif_default && netif_is_up(netif_default) && netif_is_link_up(netif_default))
+        if (wifi_supervisor_online(&wifi))
         { // Check network status
             update_readings(readings);
-            show_connection_status(); // Update display if available
-            clear_display(true);      // Clear display if available
+            update_display(readings); // Update display if available
         }
-        sleep_ms(1000);
+        display_tick(); // Present a frame deferred by the frame rate cap
+        sleep_ms(active_screen == COMPASS_SCREEN ? COMPASS_REFRESH_MS : 1000); // ~30 fps while the compass is shown
     }
 
     free(readings);
@@ -33,16 +33,40 @@ SOFTWARE.
 #include "ssd1306.h"
 #include "font.h"
 
+#if SSD1306_USE_DMA
+#include <hardware/dma.h>
+#include <hardware/irq.h>
+#endif
+
 inline static void swap(int32_t *a, int32_t *b)
 {
-    int32_t *t = a;
+    int32_t t = *a;
     *a = *b;
-    *b = *t;
+    *b = t;
 }
 
-inline static void fancy_write(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src, size_t len, char *name)
+/**
+ *	@brief commands sent in front of every window (column and page address, 2 arguments each)
+ */
+#define SSD1306_WINDOW_CMDS 6
+
+/**
+ *	@brief longest command stream sent in one transaction (the init sequence)
+ */
+#define SSD1306_MAX_CMD_STREAM 32
+
+inline static void count_write(ssd1306_t *p, size_t len)
 {
-    switch (i2c_write_blocking(i2c, addr, src, len, false))
+    p->stats.frame_bytes += len + 1; // address byte + payload
+    p->stats.frame_transactions++;
+    p->stats.total_bytes += len + 1;
+}
+
+inline static void fancy_write(ssd1306_t *p, const uint8_t *src, size_t len, char *name)
+{
+    count_write(p, len);
+
+    switch (i2c_write_blocking(p->i2c_i, p->address, src, len, false))
     {
     case PICO_ERROR_GENERIC:
         printf("[%s] addr not acknowledged!\n", name);
@@ -56,14 +80,107 @@ inline static void fancy_write(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src
     }
 }
 
+inline static void ssd1306_mark_dirty(ssd1306_t *p, uint32_t page, uint32_t x_min, uint32_t x_max)
+{
+    if (x_min < p->dirty_min[page])
+        p->dirty_min[page] = x_min;
+    if (x_max > p->dirty_max[page])
+        p->dirty_max[page] = x_max;
+}
+
+inline static void ssd1306_mark_clean(ssd1306_t *p)
+{
+    memset(p->dirty_min, SSD1306_CLEAN, sizeof(p->dirty_min));
+    memset(p->dirty_max, 0, sizeof(p->dirty_max));
+}
+
+/**
+ *	@brief sends several commands behind a single control byte, in one I2C transaction
+ */
+static void ssd1306_write_cmds(ssd1306_t *p, const uint8_t *cmds, size_t len)
+{
+    uint8_t d[1 + SSD1306_MAX_CMD_STREAM];
+
+    if (len > SSD1306_MAX_CMD_STREAM)
+        len = SSD1306_MAX_CMD_STREAM;
+
+    d[0] = 0x00; // Co = 0, D/C# = 0: every following byte is a command
+    memcpy(d + 1, cmds, len);
+
+    ssd1306_flush_wait(p); // a blocking write reprograms the target address and would cut the DMA transfer
+    fancy_write(p, d, len + 1, "ssd1306_write");
+}
+
 inline static void ssd1306_write(ssd1306_t *p, uint8_t val)
 {
-    uint8_t d[2] = {0x00, val};
-    fancy_write(p->i2c_i, p->address, d, 2, "ssd1306_write");
+    ssd1306_write_cmds(p, &val, 1);
 }
 
+#if SSD1306_USE_DMA
+static ssd1306_t *dma_displays[NUM_DMA_CHANNELS];
+
+static void ssd1306_flush_done(ssd1306_t *p)
+{
+    ssd1306_flush_cb_t cb = p->flush_cb;
+
+    p->flush_cb = NULL;
+    if (cb)
+        cb(p->flush_cb_data);
+}
+
+static void ssd1306_dma_irq_handler(void)
+{
+    for (uint ch = 0; ch < NUM_DMA_CHANNELS; ++ch)
+    {
+        if (dma_displays[ch] && dma_channel_get_irq1_status(ch))
+        {
+            dma_channel_acknowledge_irq1(ch);
+            ssd1306_flush_done(dma_displays[ch]);
+        }
+    }
+}
+
+static void ssd1306_dma_init(ssd1306_t *p)
+{
+    static bool irq_installed = false;
+
+    p->stage_cap = (size_t)p->pages * (p->width + 2 + SSD1306_WINDOW_CMDS); // worst case: one window per page
+    if ((p->stage = malloc(p->stage_cap * sizeof(uint16_t))) == NULL)
+        return;
+
+    int ch = dma_claim_unused_channel(false);
+    if (ch < 0)
+    {
+        free(p->stage);
+        p->stage = NULL;
+        return;
+    }
+
+    // 16-bit words carry the data byte plus the STOP flag of IC_DATA_CMD
+    dma_channel_config c = dma_channel_get_default_config(ch);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_dreq(&c, i2c_get_dreq(p->i2c_i, true));
+    dma_channel_configure(ch, &c, &i2c_get_hw(p->i2c_i)->data_cmd, p->stage, 0, false);
+
+    if (!irq_installed)
+    {
+        irq_add_shared_handler(DMA_IRQ_1, ssd1306_dma_irq_handler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+        irq_set_enabled(DMA_IRQ_1, true);
+        irq_installed = true;
+    }
+
+    dma_displays[ch] = p;
+    dma_channel_set_irq1_enabled(ch, true);
+    p->dma_channel = ch;
+}
+#endif
+
 bool ssd1306_init(ssd1306_t *p, uint16_t width, uint16_t height, uint8_t address, i2c_inst_t *i2c_instance)
 {
+    uint64_t start_us = time_us_64();
+
     p->width = width;
     p->height = height;
     p->pages = height / 8;
@@ -79,6 +196,20 @@ bool ssd1306_init(ssd1306_t *p, uint16_t width, uint16_t height, uint8_t address
     }
 
     ++(p->buffer);
+    memset(p->buffer, 0, p->bufsize);
+
+    p->dma_channel = -1;
+    p->stage = NULL;
+    p->stage_len = 0;
+    p->stage_cap = 0;
+    p->flush_cb = NULL;
+    p->flush_cb_data = NULL;
+#if SSD1306_USE_DMA
+    ssd1306_dma_init(p); // on failure flushes fall back to blocking writes
+#endif
+    memset(&p->stats, 0, sizeof(p->stats));
+    ssd1306_mark_clean(p);
+    ssd1306_mark_all_dirty(p); // panel RAM content is undefined after power-up
 
     // from https://github.com/makerportal/rpi-pico-ssd1306
     uint8_t cmds[] = {
@@ -114,14 +245,25 @@ bool ssd1306_init(ssd1306_t *p, uint16_t width, uint16_t height, uint8_t address
         0x00, // horizontal
     };
 
-    for (size_t i = 0; i < sizeof(cmds); ++i)
-        ssd1306_write(p, cmds[i]);
+    ssd1306_write_cmds(p, cmds, sizeof(cmds));
 
+    p->stats.init_us = time_us_64() - start_us;
     return true;
 }
 
 inline void ssd1306_deinit(ssd1306_t *p)
 {
+    ssd1306_flush_wait(p);
+#if SSD1306_USE_DMA
+    if (p->dma_channel >= 0)
+    {
+        dma_channel_set_irq1_enabled(p->dma_channel, false);
+        dma_displays[p->dma_channel] = NULL;
+        dma_channel_unclaim(p->dma_channel);
+        p->dma_channel = -1;
+    }
+#endif
+    free(p->stage);
     free(p->buffer - 1);
 }
 
@@ -137,8 +279,9 @@ inline void ssd1306_poweron(ssd1306_t *p)
 
 inline void ssd1306_contrast(ssd1306_t *p, uint8_t val)
 {
-    ssd1306_write(p, SET_CONTRAST);
-    ssd1306_write(p, val);
+    uint8_t cmds[] = {SET_CONTRAST, val};
+
+    ssd1306_write_cmds(p, cmds, sizeof(cmds));
 }
 
 inline void ssd1306_invert(ssd1306_t *p, uint8_t inv)
@@ -146,8 +289,42 @@ inline void ssd1306_invert(ssd1306_t *p, uint8_t inv)
     ssd1306_write(p, SET_NORM_INV | (inv & 1));
 }
 
-inline void ssd1306_clear(ssd1306_t *p)
+inline void ssd1306_mark_all_dirty(ssd1306_t *p)
+{
+    for (uint8_t page = 0; page < p->pages; ++page)
+        ssd1306_mark_dirty(p, page, 0, p->width - 1);
+}
+
+bool ssd1306_is_dirty(ssd1306_t *p)
+{
+    for (uint8_t page = 0; page < p->pages; ++page)
+        if (p->dirty_min[page] != SSD1306_CLEAN)
+            return true;
+    return false;
+}
+
+void ssd1306_clear(ssd1306_t *p)
 {
+    // only columns that were lit need to be sent again
+    for (uint8_t page = 0; page < p->pages; ++page)
+    {
+        uint8_t *line = p->buffer + page * p->width;
+        int32_t first = -1, last = -1;
+
+        for (uint32_t x = 0; x < p->width; ++x)
+        {
+            if (line[x])
+            {
+                if (first < 0)
+                    first = x;
+                last = x;
+            }
+        }
+
+        if (first >= 0)
+            ssd1306_mark_dirty(p, page, first, last);
+    }
+
     memset(p->buffer, 0, p->bufsize);
 }
 
@@ -156,7 +333,13 @@ void ssd1306_clear_pixel(ssd1306_t *p, uint32_t x, uint32_t y)
     if (x >= p->width || y >= p->height)
         return;
 
-    p->buffer[x + p->width * (y >> 3)] &= ~(0x1 << (y & 0x07));
+    uint8_t *byte = &p->buffer[x + p->width * (y >> 3)];
+    uint8_t mask = 0x1 << (y & 0x07);
+    if (*byte & mask)
+    {
+        *byte &= ~mask;
+        ssd1306_mark_dirty(p, y >> 3, x, x);
+    }
 }
 
 void ssd1306_draw_pixel(ssd1306_t *p, uint32_t x, uint32_t y)
@@ -164,7 +347,13 @@ void ssd1306_draw_pixel(ssd1306_t *p, uint32_t x, uint32_t y)
     if (x >= p->width || y >= p->height)
         return;
 
-    p->buffer[x + p->width * (y >> 3)] |= 0x1 << (y & 0x07); // y>>3==y/8 && y&0x7==y%8
+    uint8_t *byte = &p->buffer[x + p->width * (y >> 3)]; // y>>3==y/8 && y&0x7==y%8
+    uint8_t mask = 0x1 << (y & 0x07);
+    if (!(*byte & mask))
+    {
+        *byte |= mask;
+        ssd1306_mark_dirty(p, y >> 3, x, x);
+    }
 }
 
 void ssd1306_draw_line(ssd1306_t *p, int32_t x1, int32_t y1, int32_t x2, int32_t y2)
@@ -175,36 +364,116 @@ void ssd1306_draw_line(ssd1306_t *p, int32_t x1, int32_t y1, int32_t x2, int32_t
         swap(&y1, &y2);
     }
 
-    if (x1 == x2)
+    // integer Bresenham: one pixel per step along the major axis, no gaps on steep lines
+    int32_t dx = x2 - x1;
+    int32_t dy = y2 > y1 ? y2 - y1 : y1 - y2;
+    int32_t sy = y2 > y1 ? 1 : -1;
+    int32_t err = dx - dy;
+
+    for (;;)
     {
-        if (y1 > y2)
-            swap(&y1, &y2);
-        for (int32_t i = y1; i <= y2; ++i)
-            ssd1306_draw_pixel(p, x1, i);
-        return;
+        ssd1306_draw_pixel(p, x1, y1);
+        if (x1 == x2 && y1 == y2)
+            break;
+
+        int32_t e2 = 2 * err;
+        if (e2 > -dy)
+        {
+            err -= dy;
+            ++x1;
+        }
+        if (e2 < dx)
+        {
+            err += dx;
+            y1 += sy;
+        }
+    }
+}
+
+/**
+ *	@brief sets or clears a rectangle page by page, with byte masks on the partial top and bottom pages
+ */
+static void ssd1306_fill_rect(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t width, uint32_t height, bool set)
+{
+    // wrapped negative coordinates: keep the visible part, as the per-pixel routines did
+    if ((int32_t)x < 0)
+    {
+        if (width <= (uint32_t)-(int32_t)x)
+            return;
+        width += (int32_t)x;
+        x = 0;
+    }
+    if ((int32_t)y < 0)
+    {
+        if (height <= (uint32_t)-(int32_t)y)
+            return;
+        height += (int32_t)y;
+        y = 0;
     }
 
-    float m = (float)(y2 - y1) / (float)(x2 - x1);
+    if (x >= p->width || y >= p->height || !width || !height)
+        return;
+    if (width > p->width - x)
+        width = p->width - x;
+    if (height > p->height - y)
+        height = p->height - y;
+
+    uint32_t y_last = y + height - 1;
+    uint8_t fill = set ? 0xFF : 0x00;
 
-    for (int32_t i = x1; i <= x2; ++i)
+    for (uint32_t page = y >> 3; page <= y_last >> 3; ++page)
     {
-        float y = m * (float)(i - x1) + (float)y1;
-        ssd1306_draw_pixel(p, i, (uint32_t)y);
+        uint8_t mask = 0xFF;
+        if (page == y >> 3)
+            mask &= 0xFF << (y & 7);
+        if (page == y_last >> 3)
+            mask &= 0xFF >> (7 - (y_last & 7));
+
+        uint8_t *row = p->buffer + page * p->width + x;
+        int32_t first = -1, last = -1;
+
+        if (mask == 0xFF)
+        {
+            for (uint32_t i = 0; i < width; ++i)
+            {
+                if (row[i] != fill)
+                {
+                    if (first < 0)
+                        first = i;
+                    last = i;
+                }
+            }
+            if (first >= 0)
+                memset(row + first, fill, last - first + 1);
+        }
+        else
+        {
+            for (uint32_t i = 0; i < width; ++i)
+            {
+                uint8_t val = set ? row[i] | mask : row[i] & ~mask;
+                if (val != row[i])
+                {
+                    row[i] = val;
+                    if (first < 0)
+                        first = i;
+                    last = i;
+                }
+            }
+        }
+
+        if (first >= 0)
+            ssd1306_mark_dirty(p, page, x + first, x + last);
     }
 }
 
 void ssd1306_clear_square(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
 {
-    for (uint32_t i = 0; i < width; ++i)
-        for (uint32_t j = 0; j < height; ++j)
-            ssd1306_clear_pixel(p, x + i, y + j);
+    ssd1306_fill_rect(p, x, y, width, height, false);
 }
 
 void ssd1306_draw_square(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
 {
-    for (uint32_t i = 0; i < width; ++i)
-        for (uint32_t j = 0; j < height; ++j)
-            ssd1306_draw_pixel(p, x + i, y + j);
+    ssd1306_fill_rect(p, x, y, width, height, true);
 }
 
 void ssd1306_draw_empty_square(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
@@ -215,26 +484,98 @@ void ssd1306_draw_empty_square(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t wi
     ssd1306_draw_line(p, x + width, y, x + width, y + height);
 }
 
+/**
+ *	@brief each bit of a nibble doubled (glyph columns at scale 2)
+ */
+static const uint8_t expand_x2[16] = {
+    0x00, 0x03, 0x0C, 0x0F, 0x30, 0x33, 0x3C, 0x3F,
+    0xC0, 0xC3, 0xCC, 0xCF, 0xF0, 0xF3, 0xFC, 0xFF};
+
+/**
+ *	@brief each bit of a nibble tripled (glyph columns at scale 3)
+ */
+static const uint16_t expand_x3[16] = {
+    0x000, 0x007, 0x038, 0x03F, 0x1C0, 0x1C7, 0x1F8, 0x1FF,
+    0xE00, 0xE07, 0xE38, 0xE3F, 0xFC0, 0xFC7, 0xFF8, 0xFFF};
+
+void ssd1306_draw_column(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t bits)
+{
+    if (x >= p->width)
+        return;
+
+    if ((int32_t)y < 0)
+    {
+        // starts above the screen (wrapped negative coordinate): drop the hidden rows
+        if ((int32_t)y <= -32)
+            return;
+        bits >>= -(int32_t)y;
+        y = 0;
+    }
+
+    uint64_t v = (uint64_t)bits << (y & 7);
+    for (uint32_t page = y >> 3; v && page < p->pages; ++page, v >>= 8)
+    {
+        uint8_t *byte = &p->buffer[x + page * p->width];
+        uint8_t add = (uint8_t)v & ~*byte;
+
+        if (add)
+        {
+            *byte |= add;
+            ssd1306_mark_dirty(p, page, x, x);
+        }
+    }
+}
+
 void ssd1306_draw_char_with_font(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t scale, const uint8_t *font, char c)
 {
     if (c < font[3] || c > font[4])
         return;
 
     uint32_t parts_per_line = (font[0] >> 3) + ((font[0] & 7) > 0);
+
+    if (scale > 3)
+    {
+        // larger scales are rare: draw each font pixel as a square
+        for (uint8_t w = 0; w < font[1]; ++w)
+        { // width
+            uint32_t pp = (c - font[3]) * font[1] * parts_per_line + w * parts_per_line + 5;
+            for (uint32_t lp = 0; lp < parts_per_line; ++lp)
+            {
+                uint8_t line = font[pp];
+
+                for (int8_t j = 0; j < 8; ++j, line >>= 1)
+                {
+                    if (line & 1)
+                        ssd1306_draw_square(p, x + w * scale, y + ((lp << 3) + j) * scale, scale, scale);
+                }
+
+                ++pp;
+            }
+        }
+        return;
+    }
+
+    // each font byte is one 8-pixel column: stretch it vertically once and OR it into whole buffer bytes
+    const uint8_t *glyph = font + 5 + (c - font[3]) * font[1] * parts_per_line;
     for (uint8_t w = 0; w < font[1]; ++w)
-    { // width
-        uint32_t pp = (c - font[3]) * font[1] * parts_per_line + w * parts_per_line + 5;
+    {
         for (uint32_t lp = 0; lp < parts_per_line; ++lp)
         {
-            uint8_t line = font[pp];
+            uint8_t line = *glyph++;
+            uint32_t bits;
 
-            for (int8_t j = 0; j < 8; ++j, line >>= 1)
-            {
-                if (line & 1)
-                    ssd1306_draw_square(p, x + w * scale, y + ((lp << 3) + j) * scale, scale, scale);
-            }
+            if (!line)
+                continue;
 
-            ++pp;
+            if (scale == 3)
+                bits = expand_x3[line & 0x0F] | ((uint32_t)expand_x3[line >> 4] << 12);
+            else if (scale == 2)
+                bits = expand_x2[line & 0x0F] | ((uint32_t)expand_x2[line >> 4] << 8);
+            else
+                bits = line;
+
+            for (uint32_t s = 0; s < scale; ++s)
+                ssd1306_draw_column(p, x + w * scale + s, y + (lp << 3) * scale, bits);
         }
     }
 }
@@ -257,6 +598,35 @@ void ssd1306_draw_string(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t scale, c
     ssd1306_draw_string_with_font(p, x, y, scale, font_8x5, s);
 }
 
+void ssd1306_blit_pages(ssd1306_t *p, uint32_t x, uint32_t page, uint32_t width, uint32_t pages, const uint8_t *data)
+{
+    if (x >= p->width || page >= p->pages)
+        return;
+
+    uint32_t cols = width < p->width - x ? width : p->width - x;
+    uint32_t rows = pages < p->pages - page ? pages : p->pages - page;
+
+    for (uint32_t r = 0; r < rows; ++r, data += width)
+    {
+        uint8_t *line = p->buffer + (page + r) * p->width + x;
+        int32_t first = -1, last = -1;
+
+        for (uint32_t i = 0; i < cols; ++i)
+        {
+            if (line[i] != data[i])
+            {
+                line[i] = data[i];
+                if (first < 0)
+                    first = i;
+                last = i;
+            }
+        }
+
+        if (first >= 0)
+            ssd1306_mark_dirty(p, page + r, x + first, x + last);
+    }
+}
+
 static inline uint32_t ssd1306_bmp_get_val(const uint8_t *data, const size_t offset, uint8_t size)
 {
     switch (size)
@@ -328,19 +698,162 @@ inline void ssd1306_bmp_show_image(ssd1306_t *p, const uint8_t *data, const long
     ssd1306_bmp_show_image_with_offset(p, data, size, 0, 0);
 }
 
-void ssd1306_show(ssd1306_t *p)
+#if SSD1306_USE_DMA
+static void ssd1306_stage(ssd1306_t *p, uint8_t control, const uint8_t *src, size_t len)
+{
+    uint16_t *out = p->stage + p->stage_len;
+
+    count_write(p, len + 1); // control byte + payload
+
+    *out++ = control;
+    for (size_t i = 0; i < len; ++i)
+        *out++ = src[i];
+    out[-1] |= I2C_IC_DATA_CMD_STOP_BITS; // end of transaction, the next word starts a new one
+
+    p->stage_len += len + 1;
+}
+#endif
+
+static void ssd1306_send_window(ssd1306_t *p, bool staged, uint8_t col_min, uint8_t col_max, uint8_t page_min, uint8_t page_max)
+{
+    uint8_t col_offset = p->width == 64 ? 32 : 0;
+    uint8_t payload[] = {SET_COL_ADDR, col_min + col_offset, col_max + col_offset, SET_PAGE_ADDR, page_min, page_max};
+    uint8_t *start = p->buffer + page_min * p->width + col_min;
+    size_t len = (size_t)(page_max - page_min) * p->width + (col_max - col_min) + 1;
+
+#if SSD1306_USE_DMA
+    if (staged)
+    {
+        ssd1306_stage(p, 0x00, payload, sizeof(payload));
+        ssd1306_stage(p, 0x40, start, len);
+        return;
+    }
+#endif
+
+    ssd1306_write_cmds(p, payload, sizeof(payload));
+
+    // the byte in front of the window temporarily holds the data control byte
+    uint8_t saved = *(start - 1);
+
+    *(start - 1) = 0x40;
+    fancy_write(p, start - 1, len + 1, "ssd1306_show");
+    *(start - 1) = saved;
+}
+
+/**
+ *	@brief sends (or stages, for DMA) every dirty window and marks the buffer clean
+ */
+static void ssd1306_send_dirty(ssd1306_t *p, bool staged)
+{
+    p->stats.frame_bytes = 0;
+    p->stats.frame_transactions = 0;
+
+    for (uint8_t page = 0; page < p->pages; ++page)
+    {
+        if (p->dirty_min[page] == SSD1306_CLEAN)
+            continue;
+
+        uint8_t col_min = p->dirty_min[page];
+        uint8_t col_max = p->dirty_max[page];
+        uint8_t page_max = page;
+
+        // consecutive full-width pages are contiguous in the buffer: send them as one window
+        if (col_min == 0 && col_max == p->width - 1)
+        {
+            while (page_max + 1 < p->pages && p->dirty_min[page_max + 1] == 0 && p->dirty_max[page_max + 1] == p->width - 1)
+                ++page_max;
+        }
+
+        ssd1306_send_window(p, staged, col_min, col_max, page, page_max);
+        page = page_max;
+    }
+
+    if (p->stats.frame_transactions)
+        p->stats.frames++;
+
+    ssd1306_mark_clean(p);
+}
+
+bool ssd1306_show_async(ssd1306_t *p, ssd1306_flush_cb_t cb, void *user_data)
 {
-    uint8_t payload[] = {SET_COL_ADDR, 0, p->width - 1, SET_PAGE_ADDR, 0, p->pages - 1};
-    if (p->width == 64)
+    // the staging buffer is still being read by the previous transfer
+    ssd1306_flush_wait(p);
+
+#if SSD1306_USE_DMA
+    if (p->dma_channel >= 0)
+    {
+        p->stage_len = 0;
+        ssd1306_send_dirty(p, true);
+        if (!p->stage_len)
+        {
+            if (cb)
+                cb(user_data);
+            return false;
+        }
+
+        // i2c_write_blocking sets the target on every call; the DMA path has to do it itself
+        i2c_hw_t *hw = i2c_get_hw(p->i2c_i);
+        if (hw->tar != p->address)
+        {
+            hw->enable = 0;
+            hw->tar = p->address;
+            hw->enable = 1;
+        }
+
+        p->flush_cb = cb;
+        p->flush_cb_data = user_data;
+        dma_channel_transfer_from_buffer_now(p->dma_channel, p->stage, p->stage_len);
+        return true;
+    }
+#endif
+
+    ssd1306_send_dirty(p, false);
+    if (cb)
+        cb(user_data);
+    return false;
+}
+
+bool ssd1306_flush_busy(ssd1306_t *p)
+{
+#if SSD1306_USE_DMA
+    if (p->dma_channel < 0)
+        return false;
+
+    i2c_hw_t *hw = i2c_get_hw(p->i2c_i);
+    if (hw->raw_intr_stat & I2C_IC_RAW_INTR_STAT_TX_ABRT_BITS)
     {
-        payload[1] += 32;
-        payload[2] += 32;
+        // the controller flushes its FIFO on abort (e.g. address not acknowledged): drop the rest of the frame
+        uint32_t source = hw->tx_abrt_source;
+
+        dma_channel_set_irq1_enabled(p->dma_channel, false);
+        dma_channel_abort(p->dma_channel);
+        dma_channel_acknowledge_irq1(p->dma_channel);
+        dma_channel_set_irq1_enabled(p->dma_channel, true);
+        (void)hw->clr_tx_abrt;
+
+        printf("[ssd1306_show] transfer aborted (source 0x%08lx)!\n", (unsigned long)source);
+        ssd1306_flush_done(p);
+        return false;
     }
 
-    for (size_t i = 0; i < sizeof(payload); ++i)
-        ssd1306_write(p, payload[i]);
+    if (dma_channel_is_busy(p->dma_channel))
+        return true;
 
-    *(p->buffer - 1) = 0x40;
+    // DMA finished feeding the FIFO; the last bytes may still be on the bus
+    return !(hw->status & I2C_IC_STATUS_TFE_BITS) || (hw->status & I2C_IC_STATUS_MST_ACTIVITY_BITS);
+#else
+    return false;
+#endif
+}
+
+void ssd1306_flush_wait(ssd1306_t *p)
+{
+    while (ssd1306_flush_busy(p))
+        tight_loop_contents();
+}
 
-    fancy_write(p->i2c_i, p->address, p->buffer - 1, p->bufsize + 1, "ssd1306_show");
+void ssd1306_show(ssd1306_t *p)
+{
+    ssd1306_show_async(p, NULL, NULL);
+    ssd1306_flush_wait(p);
 }
@@ -0,0 +1,198 @@
+#include "compass.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "display.h"
+#include "joystick.h"
+
+/// Coluna da área de textos à direita do anel
+#define COMPASS_TEXT_X 68
+
+/// Largura da área de textos
+#define COMPASS_TEXT_WIDTH (SCREEN_WIDTH - COMPASS_TEXT_X)
+
+/// Linha da barra de intensidade
+#define COMPASS_BAR_Y 42
+
+/// Altura da barra de intensidade (incluindo a moldura)
+#define COMPASS_BAR_HEIGHT 7
+
+/// Largura da barra de intensidade (incluindo a moldura)
+#define COMPASS_BAR_WIDTH 58
+
+/// Linha dos indicadores de botão
+#define COMPASS_BUTTON_Y 55
+
+/// Lado dos indicadores de botão
+#define COMPASS_BUTTON_SIZE 8
+
+/// Anel da rosa dos ventos com marcas dos 16 pontos (64x64, 8 páginas de 64 colunas)
+static const uint8_t compass_ring[COMPASS_SIZE * COMPASS_PAGES] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x80, 0x40, 0x40, 0x20, 0xE0, 0x10, 0x10, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08, 0xF8,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x10, 0x10, 0x10, 0xE0, 0x20, 0x40, 0x40, 0x80, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x30, 0x08, 0x14, 0x24, 0x02, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x02, 0x24, 0x14, 0x08, 0x30, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xC0, 0x30, 0x2C, 0x23, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x23, 0x2C, 0x30, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFC, 0x83, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x83, 0xFC, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x1A, 0x62, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x62, 0x1A, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x08, 0x14, 0x12, 0x20, 0x40,
+    0x80, 0x80, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x80, 0x80, 0x40,
+    0x20, 0x12, 0x14, 0x08, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x01, 0x02, 0x03, 0x04, 0x04, 0x04, 0x04, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0F,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x03, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+/// Extremidade do ponteiro (dx, dy) relativa ao centro para cada passo de 360/COMPASS_NEEDLE_STEPS graus
+static const int8_t compass_needle[COMPASS_NEEDLE_STEPS][2] = {
+    {0, -22}, {1, -22}, {2, -22}, {3, -22}, {4, -22}, {5, -21}, {6, -21}, {7, -21},
+    {8, -20}, {9, -20}, {10, -19}, {11, -19}, {12, -18}, {13, -18}, {14, -17}, {15, -16},
+    {16, -16}, {16, -15}, {17, -14}, {18, -13}, {18, -12}, {19, -11}, {19, -10}, {20, -9},
+    {20, -8}, {21, -7}, {21, -6}, {21, -5}, {22, -4}, {22, -3}, {22, -2}, {22, -1},
+    {22, 0}, {22, 1}, {22, 2}, {22, 3}, {22, 4}, {21, 5}, {21, 6}, {21, 7},
+    {20, 8}, {20, 9}, {19, 10}, {19, 11}, {18, 12}, {18, 13}, {17, 14}, {16, 15},
+    {16, 16}, {15, 16}, {14, 17}, {13, 18}, {12, 18}, {11, 19}, {10, 19}, {9, 20},
+    {8, 20}, {7, 21}, {6, 21}, {5, 21}, {4, 22}, {3, 22}, {2, 22}, {1, 22},
+    {0, 22}, {-1, 22}, {-2, 22}, {-3, 22}, {-4, 22}, {-5, 21}, {-6, 21}, {-7, 21},
+    {-8, 20}, {-9, 20}, {-10, 19}, {-11, 19}, {-12, 18}, {-13, 18}, {-14, 17}, {-15, 16},
+    {-16, 16}, {-16, 15}, {-17, 14}, {-18, 13}, {-18, 12}, {-19, 11}, {-19, 10}, {-20, 9},
+    {-20, 8}, {-21, 7}, {-21, 6}, {-21, 5}, {-22, 4}, {-22, 3}, {-22, 2}, {-22, 1},
+    {-22, 0}, {-22, -1}, {-22, -2}, {-22, -3}, {-22, -4}, {-21, -5}, {-21, -6}, {-21, -7},
+    {-20, -8}, {-20, -9}, {-19, -10}, {-19, -11}, {-18, -12}, {-18, -13}, {-17, -14}, {-16, -15},
+    {-16, -16}, {-15, -16}, {-14, -17}, {-13, -18}, {-12, -18}, {-11, -19}, {-10, -19}, {-9, -20},
+    {-8, -20}, {-7, -21}, {-6, -21}, {-5, -21}, {-4, -22}, {-3, -22}, {-2, -22}, {-1, -22},
+};
+
+/// Quadro do anel montado fora da tela antes de ser copiado para o display
+static uint8_t compass_frame[COMPASS_SIZE * COMPASS_PAGES];
+
+/// Campo com a direção abreviada
+static int direction_field = -1;
+
+/// Campo com o rumo em graus
+static int heading_field = -1;
+
+/**
+ * @brief Acende um pixel do quadro do anel.
+ */
+static inline void frame_pixel(int32_t x, int32_t y)
+{
+    if (x >= 0 && x < COMPASS_SIZE && y >= 0 && y < COMPASS_SIZE)
+        compass_frame[(y >> 3) * COMPASS_SIZE + x] |= 1 << (y & 7);
+}
+
+/**
+ * @brief Desenha o ponteiro do centro até (x1, y1) no quadro do anel (Bresenham).
+ */
+static void frame_needle(int32_t x1, int32_t y1)
+{
+    int32_t x = COMPASS_CENTER, y = COMPASS_CENTER;
+    int32_t dx = x1 > x ? x1 - x : x - x1;
+    int32_t dy = y1 > y ? y1 - y : y - y1;
+    int32_t sx = x1 > x ? 1 : -1;
+    int32_t sy = y1 > y ? 1 : -1;
+    int32_t err = dx - dy;
+
+    for (;;)
+    {
+        frame_pixel(x, y);
+        if (x == x1 && y == y1)
+            break;
+
+        int32_t e2 = 2 * err;
+        if (e2 > -dy)
+        {
+            err -= dy;
+            x += sx;
+        }
+        if (e2 < dx)
+        {
+            err += dx;
+            y += sy;
+        }
+    }
+}
+
+/**
+ * @brief Desenha a moldura de um indicador de botão e seu rótulo.
+ */
+static void draw_button_frame(uint8_t x, const char *label)
+{
+    display_label(x, COMPASS_BUTTON_Y, label);
+    ssd1306_draw_empty_square(&display, x + 8, COMPASS_BUTTON_Y, COMPASS_BUTTON_SIZE - 1, COMPASS_BUTTON_SIZE - 1);
+}
+
+/**
+ * @brief Preenche ou esvazia o interior de um indicador de botão.
+ */
+static void draw_button_state(uint8_t x, bool pressed)
+{
+    if (pressed)
+        ssd1306_draw_square(&display, x + 10, COMPASS_BUTTON_Y + 2, COMPASS_BUTTON_SIZE - 4, COMPASS_BUTTON_SIZE - 4);
+    else
+        ssd1306_clear_square(&display, x + 10, COMPASS_BUTTON_Y + 2, COMPASS_BUTTON_SIZE - 4, COMPASS_BUTTON_SIZE - 4);
+}
+
+void compass_show(uint8_t screen_id, const compass_view_t *view)
+{
+    if (display_screen_begin(screen_id))
+    {
+        direction_field = display_field(COMPASS_TEXT_X, 0, COMPASS_TEXT_WIDTH, &font_large, TEXT_ALIGN_CENTER);
+        heading_field = display_field(COMPASS_TEXT_X, 3, COMPASS_TEXT_WIDTH, &font_small, TEXT_ALIGN_RIGHT);
+        display_label(COMPASS_TEXT_X, 32, "Intensidade");
+        ssd1306_draw_empty_square(&display, COMPASS_TEXT_X, COMPASS_BAR_Y, COMPASS_BAR_WIDTH - 1, COMPASS_BAR_HEIGHT - 1);
+        draw_button_frame(COMPASS_TEXT_X, "A");
+        draw_button_frame(COMPASS_TEXT_X + 30, "B");
+    }
+
+    // anel + ponteiro montados fora da tela; a cópia marca só os bytes que mudaram
+    memcpy(compass_frame, compass_ring, sizeof(compass_frame));
+    if (view->direction != WIND_ROSE_CENTER)
+    {
+        uint32_t step = ((uint32_t)view->heading * COMPASS_NEEDLE_STEPS + 1800) / 3600 % COMPASS_NEEDLE_STEPS;
+        frame_needle(COMPASS_CENTER + compass_needle[step][0], COMPASS_CENTER + compass_needle[step][1]);
+    }
+    for (int32_t i = -1; i <= 1; ++i)
+    {
+        frame_pixel(COMPASS_CENTER + i, COMPASS_CENTER);
+        frame_pixel(COMPASS_CENTER, COMPASS_CENTER + i);
+    }
+    ssd1306_blit_pages(&display, 0, 0, COMPASS_SIZE, COMPASS_PAGES, compass_frame);
+
+    char text[16];
+    display_field_set(direction_field, wind_rose_abbrev(view->direction));
+    snprintf(text, sizeof(text), "%u.%u gr", view->heading / 10, view->heading % 10);
+    display_field_set(heading_field, view->direction != WIND_ROSE_CENTER ? text : "---");
+
+    uint32_t inner = COMPASS_BAR_WIDTH - 4; // moldura + 1 pixel de folga de cada lado
+    uint32_t filled = (uint32_t)view->magnitude * inner / JOYSTICK_FULL_SCALE;
+    if (filled > inner)
+        filled = inner;
+    ssd1306_draw_square(&display, COMPASS_TEXT_X + 2, COMPASS_BAR_Y + 2, filled, COMPASS_BAR_HEIGHT - 4);
+    ssd1306_clear_square(&display, COMPASS_TEXT_X + 2 + filled, COMPASS_BAR_Y + 2, inner - filled, COMPASS_BAR_HEIGHT - 4);
+
+    draw_button_state(COMPASS_TEXT_X, view->button_a);
+    draw_button_state(COMPASS_TEXT_X + 30, view->button_b);
+
+    display_render();
+}
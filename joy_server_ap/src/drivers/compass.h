@@ -0,0 +1,58 @@
+/**
+ * @file compass.h
+ * @brief Widget de bússola (rosa dos ventos) para o display OLED.
+ *
+ * Ocupa a tela inteira: à esquerda, um anel de 64x64 pixels com o ponteiro do
+ * joystick; à direita, a direção abreviada, o rumo em graus, uma barra de
+ * intensidade e o estado dos botões. O anel vem de uma tabela pré-calculada e
+ * o ponteiro de uma tabela de extremidades, de modo que um quadro é montado
+ * sem trigonometria e só os bytes alterados seguem para o display.
+ */
+
+#ifndef COMPASS_H
+#define COMPASS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "wind_rose.h"
+
+/// Lado do anel em pixels
+#define COMPASS_SIZE 64
+
+/// Páginas (linhas de 8 pixels) ocupadas pelo anel
+#define COMPASS_PAGES (COMPASS_SIZE / 8)
+
+/// Coordenada do centro do anel (x e y)
+#define COMPASS_CENTER 31
+
+/// Resolução angular do ponteiro (passos por volta)
+#define COMPASS_NEEDLE_STEPS 128
+
+/// Intervalo entre quadros da bússola para cerca de 30 quadros por segundo
+#define COMPASS_REFRESH_MS 33
+
+/**
+ * @brief Valores exibidos pela bússola.
+ */
+typedef struct
+{
+    uint16_t heading;          ///< Rumo em décimos de grau (0 = norte, sentido horário)
+    uint16_t magnitude;        ///< Intensidade (0 a JOYSTICK_FULL_SCALE)
+    wind_rose_dir_t direction; ///< Direção da rosa dos ventos (WIND_ROSE_CENTER esconde o ponteiro)
+    bool button_a;             ///< Botão A pressionado
+    bool button_b;             ///< Botão B pressionado
+} compass_view_t;
+
+/**
+ * @brief Desenha a bússola e envia as alterações ao display.
+ *
+ * Na primeira chamada (ou depois de outra tela ter sido exibida) monta os
+ * elementos estáticos; nas seguintes só atualiza o que mudou.
+ *
+ * @param screen_id Identificador da tela retida usado para a bússola.
+ * @param view Valores a exibir.
+ */
+void compass_show(uint8_t screen_id, const compass_view_t *view);
+
+#endif
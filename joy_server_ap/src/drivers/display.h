@@ -10,6 +10,7 @@
 #define DISPLAY_H
 
 #include "ssd1306.h"
+#include "text.h"
 #include "hardware/i2c.h"
 #include <stdio.h>
 #include "pico/stdlib.h"
@@ -32,6 +33,47 @@
 /// Pino SCL do barramento I2C
 #define I2C_SCL 15
 
+/// Quantidade máxima de campos dinâmicos na tela retida
+#define DISPLAY_MAX_FIELDS 8
+
+/// Tamanho máximo do texto de um campo (incluindo o terminador)
+#define DISPLAY_FIELD_TEXT_LEN 24
+
+/// Limite padrão de quadros por segundo do compositor
+#define DISPLAY_MAX_FPS 30
+
+/// Identificador de tela usado quando nenhuma tela retida está desenhada
+#define DISPLAY_SCREEN_NONE 0
+
+/**
+ * @brief Campo de texto da tela retida, redesenhado apenas quando seu conteúdo muda.
+ */
+typedef struct
+{
+    uint8_t x;                         ///< Coluna do canto superior esquerdo
+    uint8_t page;                      ///< Página (linha de 8 pixels) do topo
+    uint8_t width;                     ///< Largura da caixa em pixels
+    text_align_t align;                ///< Alinhamento do texto na caixa
+    const font_t *font;                ///< Fonte do campo
+    char text[DISPLAY_FIELD_TEXT_LEN]; ///< Texto exibido atualmente
+} display_field_t;
+
+/**
+ * @brief Estatísticas do compositor.
+ */
+typedef struct
+{
+    uint32_t presented;    ///< Quadros enviados ao display
+    uint32_t skipped;      ///< Pedidos descartados por não haver mudanças
+    uint32_t deferred;     ///< Pedidos adiados pelo limite de quadros por segundo
+    uint32_t frame_us;     ///< Tempo de preparação do último quadro
+    uint32_t max_frame_us; ///< Maior tempo de preparação observado
+    uint32_t interval_us;  ///< Intervalo entre os dois últimos quadros enviados
+} display_stats_t;
+
+/// Altura de uma linha de show() em pixels (fonte pequena + 2 pixels de espaço)
+#define DISPLAY_LINE_HEIGHT 10
+
 /// Objeto que representa o display SSD1306
 extern ssd1306_t display;
 
@@ -53,9 +95,10 @@ int init_display();
  * @brief Exibe uma string no display.
  *
  * Desenha o texto a partir da posição atual de Y no display. Pode atualizar imediatamente a tela.
+ * Descarta a tela retida atual, pois o texto pode sobrepor seus campos.
  *
  * @param text Texto a ser exibido.
- * @param render_now Se verdadeiro, o conteúdo será renderizado imediatamente.
+ * @param render_now Se verdadeiro, pede ao compositor que apresente o quadro.
  */
 void show(const char *text, bool render_now);
 
@@ -63,9 +106,102 @@ void show(const char *text, bool render_now);
  * @brief Limpa o display.
  *
  * Apaga o conteúdo da tela e exibe uma linha divisória. Opcionalmente, reinicia as coordenadas globais.
+ * Descarta a tela retida atual.
  *
  * @param reset_screen Se verdadeiro, zera as variáveis globais de posição.
  */
 void clear_display(bool reset_screen);
 
+/**
+ * @brief Inicia a construção de uma tela retida.
+ *
+ * Se a tela `screen_id` já estiver desenhada, nada é feito e os campos
+ * existentes continuam válidos. Caso contrário, o display é limpo, os campos
+ * são descartados e o chamador deve desenhar os rótulos e criar os campos.
+ *
+ * @param screen_id Identificador da tela (diferente de DISPLAY_SCREEN_NONE).
+ * @return true se a tela precisa ser construída.
+ */
+bool display_screen_begin(uint8_t screen_id);
+
+/**
+ * @brief Desenha um rótulo estático da tela retida (desenhado uma única vez) com a fonte pequena.
+ *
+ * @param x Coluna do texto.
+ * @param y Linha do texto.
+ * @param text Texto do rótulo.
+ */
+void display_label(uint8_t x, uint8_t y, const char *text);
+
+/**
+ * @brief Cria um campo dinâmico na tela retida.
+ *
+ * O campo ocupa uma caixa alinhada a páginas com a altura da fonte; o texto
+ * é recortado na caixa e o fundo é substituído a cada atualização.
+ *
+ * @param x Coluna do campo.
+ * @param page Página do topo do campo (y / 8).
+ * @param width Largura da caixa em pixels.
+ * @param font Fonte do campo (font_small, font_medium ou font_large).
+ * @param align Alinhamento do texto (TEXT_ALIGN_RIGHT para números).
+ * @return Índice do campo, ou -1 se não houver espaço.
+ */
+int display_field(uint8_t x, uint8_t page, uint8_t width, const font_t *font, text_align_t align);
+
+/**
+ * @brief Atualiza o texto de um campo.
+ *
+ * A caixa só é recomposta se o texto for diferente do atual, e só os bytes
+ * que mudaram seguem para o display.
+ *
+ * @param field Índice retornado por display_field().
+ * @param text Novo texto.
+ */
+void display_field_set(int field, const char *text);
+
+/**
+ * @brief Pede ao compositor que apresente o quadro atual.
+ *
+ * O desenho é feito no framebuffer (buffer de trás) por qualquer parte do
+ * código; o compositor envia ao display no máximo DISPLAY_MAX_FPS quadros por
+ * segundo. Se o intervalo mínimo ainda não passou, o pedido fica pendente e é
+ * atendido por display_tick(). Sem mudanças, nada é enviado.
+ */
+void display_render();
+
+/**
+ * @brief Atende um pedido pendente quando o intervalo entre quadros permitir.
+ *
+ * Deve ser chamada no laço principal.
+ *
+ * @return true se um quadro foi enviado.
+ */
+bool display_tick();
+
+/**
+ * @brief Envia o quadro atual imediatamente, ignorando o limite, e espera o envio terminar.
+ *
+ * Para mensagens exibidas antes de operações bloqueantes (ex.: calibração).
+ */
+void display_flush();
+
+/**
+ * @brief Instante em que um pedido pendente poderá ser atendido.
+ *
+ * @return Tempo absoluto em microssegundos, ou UINT64_MAX sem pedido pendente.
+ */
+uint64_t display_next_present_us();
+
+/**
+ * @brief Altera o limite de quadros por segundo do compositor.
+ *
+ * @param fps Quadros por segundo (0 volta ao padrão DISPLAY_MAX_FPS).
+ */
+void display_set_max_fps(uint8_t fps);
+
+/**
+ * @brief Estatísticas do compositor.
+ */
+const display_stats_t *display_get_stats();
+
 #endif
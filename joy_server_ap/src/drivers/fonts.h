@@ -0,0 +1,47 @@
+/**
+ * @file fonts.h
+ * @brief Atlas de fontes proporcionais para o display OLED.
+ *
+ * Os dados são gerados por tools/fontgen/fontgen.py (arquivo fonts.c) e
+ * ficam na flash. Cada glifo é armazenado por páginas, no mesmo formato do
+ * framebuffer do SSD1306: `pages` linhas de `width` bytes, bit 0 no topo.
+ */
+
+#ifndef FONTS_H
+#define FONTS_H
+
+#include <stdint.h>
+
+/**
+ * @brief Localização de um glifo dentro dos dados da fonte.
+ */
+typedef struct
+{
+    uint16_t offset; ///< Índice do primeiro byte do glifo em font_t::data
+    uint8_t width;   ///< Largura do glifo em colunas
+} font_glyph_t;
+
+/**
+ * @brief Fonte proporcional.
+ */
+typedef struct
+{
+    uint8_t height;             ///< Altura em pixels
+    uint8_t pages;              ///< Páginas ocupadas por coluna (altura / 8, arredondado para cima)
+    uint8_t spacing;            ///< Colunas vazias entre glifos
+    uint8_t first;              ///< Primeiro caractere presente
+    uint8_t last;               ///< Último caractere presente
+    const font_glyph_t *glyphs; ///< Um glifo por caractere de `first` a `last`
+    const uint8_t *data;        ///< Colunas de todos os glifos
+} font_t;
+
+/// Fonte de 8 pixels de altura
+extern const font_t font_small;
+
+/// Fonte de 16 pixels de altura
+extern const font_t font_medium;
+
+/// Fonte de 24 pixels de altura
+extern const font_t font_large;
+
+#endif
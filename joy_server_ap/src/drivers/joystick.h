@@ -0,0 +1,108 @@
+/**
+ * @file joystick.h
+ * @brief Interface para leitura e normalização do joystick analógico.
+ *
+ * Cada eixo possui uma calibração própria (centro, extremos e zona morta),
+ * aprendida por uma rotina de calibração e persistida na flash. A normalização
+ * usa apenas aritmética inteira (multiplicação e deslocamento por um recíproco
+ * pré-calculado), sem divisão em ponto flutuante a cada amostra.
+ */
+
+#ifndef JOYSTICK_H
+#define JOYSTICK_H
+
+#include <stdint.h>
+
+#include "hardware/adc.h"
+#include "pico/stdlib.h"
+
+/// Pino GPIO do eixo Y do joystick (ADC0)
+#define JOYSTICK_Y_PIN 26
+
+/// Pino GPIO do eixo X do joystick (ADC1)
+#define JOYSTICK_X_PIN 27
+
+/// Valor normalizado correspondente ao extremo de um eixo (Q15)
+#define JOYSTICK_FULL_SCALE 32767
+
+/// Converte um valor normalizado para float (-1.0 a 1.0); usar apenas na saída (logs, JSON, HTML)
+#define JOYSTICK_TO_FLOAT(v) ((float)(v) * (1.0f / JOYSTICK_FULL_SCALE))
+
+/// Duração padrão da etapa de varredura dos extremos na calibração
+#define JOYSTICK_CALIBRATION_SWEEP_MS 5000
+
+/**
+ * @brief Eixos do joystick.
+ */
+typedef enum
+{
+    JOYSTICK_AXIS_X = 0,
+    JOYSTICK_AXIS_Y,
+    JOYSTICK_AXIS_COUNT
+} joystick_axis_t;
+
+/**
+ * @brief Calibração de um eixo, em contagens brutas do ADC (0 a 4095).
+ */
+typedef struct
+{
+    uint16_t center;    ///< Leitura com o joystick em repouso
+    uint16_t min;       ///< Menor leitura observada
+    uint16_t max;       ///< Maior leitura observada
+    uint16_t dead_zone; ///< Raio da zona morta em torno do centro
+} joystick_axis_cal_t;
+
+/**
+ * @brief Inicializa o ADC do joystick e carrega a calibração.
+ *
+ * Usa a calibração salva na flash quando existir. Caso contrário, assume que o
+ * joystick está em repouso e mede apenas o centro e a zona morta; os extremos
+ * são ampliados automaticamente conforme o uso.
+ */
+void joystick_init();
+
+/**
+ * @brief Executa a calibração completa e a salva na flash.
+ *
+ * Mede centro e ruído com o joystick em repouso e, em seguida, registra os
+ * extremos de cada eixo enquanto o usuário gira o joystick.
+ *
+ * @param sweep_ms Duração da etapa de varredura dos extremos.
+ * @return true se a calibração foi salva.
+ */
+bool joystick_calibrate(uint32_t sweep_ms);
+
+/**
+ * @brief Lê o ADC de um eixo sem normalização.
+ *
+ * @param axis Eixo a ser lido.
+ * @return Leitura bruta (0 a 4095).
+ */
+uint16_t joystick_read_raw(joystick_axis_t axis);
+
+/**
+ * @brief Normaliza uma leitura bruta usando a calibração do eixo.
+ *
+ * @param axis Eixo da leitura.
+ * @param raw Leitura bruta do ADC.
+ * @return Valor entre -JOYSTICK_FULL_SCALE e JOYSTICK_FULL_SCALE (0 na zona morta).
+ */
+int16_t joystick_normalize(joystick_axis_t axis, uint16_t raw);
+
+/**
+ * @brief Lê e normaliza um eixo.
+ *
+ * @param axis Eixo a ser lido.
+ * @return Valor entre -JOYSTICK_FULL_SCALE e JOYSTICK_FULL_SCALE.
+ */
+int16_t joystick_read(joystick_axis_t axis);
+
+/**
+ * @brief Retorna a calibração em uso para um eixo.
+ *
+ * @param axis Eixo consultado.
+ * @return Ponteiro para a calibração (somente leitura).
+ */
+const joystick_axis_cal_t *joystick_get_calibration(joystick_axis_t axis);
+
+#endif
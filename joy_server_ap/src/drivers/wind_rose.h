@@ -0,0 +1,117 @@
+/**
+ * @file wind_rose.h
+ * @brief Conversão da posição do joystick em rumo, intensidade e ponto da rosa dos ventos.
+ *
+ * O rumo e a intensidade são obtidos por um núcleo CORDIC em ponto fixo (sem
+ * ponto flutuante nem tabelas de seno). A direção é um dos 16 pontos da rosa
+ * dos ventos, com histerese para não oscilar nas fronteiras entre setores. As
+ * direções circulam como identificadores numéricos; os textos só são obtidos
+ * na saída (HTML, JSON, display).
+ */
+
+#ifndef WIND_ROSE_H
+#define WIND_ROSE_H
+
+#include <stdint.h>
+
+/// Quantidade de pontos da rosa dos ventos (sem contar o centro)
+#define WIND_ROSE_POINTS 16
+
+/// Intensidade abaixo da qual a direção passa a ser o centro (0,40 em Q15)
+#define WIND_ROSE_CENTER_ENTER 13107
+
+/// Intensidade acima da qual a direção deixa o centro (0,50 em Q15)
+#define WIND_ROSE_CENTER_EXIT 16384
+
+/// Margem, em graus, além da fronteira do setor antes de trocar de direção
+#define WIND_ROSE_HYSTERESIS_DEG 3
+
+/**
+ * @brief Pontos da rosa dos ventos, no sentido horário a partir do norte.
+ */
+typedef enum
+{
+    WIND_ROSE_N = 0,
+    WIND_ROSE_NNE,
+    WIND_ROSE_NE,
+    WIND_ROSE_ENE,
+    WIND_ROSE_E,
+    WIND_ROSE_ESE,
+    WIND_ROSE_SE,
+    WIND_ROSE_SSE,
+    WIND_ROSE_S,
+    WIND_ROSE_SSW,
+    WIND_ROSE_SW,
+    WIND_ROSE_WSW,
+    WIND_ROSE_W,
+    WIND_ROSE_WNW,
+    WIND_ROSE_NW,
+    WIND_ROSE_NNW,
+    WIND_ROSE_CENTER,
+    WIND_ROSE_DIR_COUNT
+} wind_rose_dir_t;
+
+/**
+ * @brief Vetor do joystick em coordenadas polares.
+ */
+typedef struct
+{
+    uint16_t angle;     ///< Rumo em ângulo binário (65536 = uma volta), 0 = norte, sentido horário
+    uint16_t heading;   ///< Rumo em décimos de grau (0 a 3599)
+    uint16_t magnitude; ///< Intensidade, na mesma escala das coordenadas de entrada
+} wind_rose_polar_t;
+
+/**
+ * @brief Estado da classificação com histerese.
+ */
+typedef struct
+{
+    wind_rose_dir_t dir; ///< Última direção reportada
+} wind_rose_t;
+
+/**
+ * @brief Converte coordenadas cartesianas em rumo e intensidade (CORDIC).
+ *
+ * @param x Componente leste (positivo) / oeste (negativo).
+ * @param y Componente norte (positivo) / sul (negativo).
+ * @param out Resultado em coordenadas polares.
+ */
+void wind_rose_polar(int16_t x, int16_t y, wind_rose_polar_t *out);
+
+/**
+ * @brief Inicializa o estado da classificação (direção inicial: centro).
+ *
+ * @param rose Estado a ser inicializado.
+ */
+void wind_rose_init(wind_rose_t *rose);
+
+/**
+ * @brief Classifica um vetor polar em um ponto da rosa dos ventos.
+ *
+ * A direção atual só muda quando o rumo ultrapassa a fronteira do setor por
+ * mais de WIND_ROSE_HYSTERESIS_DEG graus, e o centro usa limiares distintos
+ * de entrada e saída.
+ *
+ * @param rose Estado da classificação.
+ * @param polar Vetor a ser classificado.
+ * @return Direção resultante.
+ */
+wind_rose_dir_t wind_rose_update(wind_rose_t *rose, const wind_rose_polar_t *polar);
+
+/**
+ * @brief Nome da direção por extenso (ex.: "NORDESTE", "CENTRO").
+ *
+ * @param dir Direção.
+ * @return Texto constante.
+ */
+const char *wind_rose_name(wind_rose_dir_t dir);
+
+/**
+ * @brief Sigla da direção (ex.: "NE", "SSO", "C").
+ *
+ * @param dir Direção.
+ * @return Texto constante.
+ */
+const char *wind_rose_abbrev(wind_rose_dir_t dir);
+
+#endif
@@ -33,6 +33,13 @@ SOFTWARE.
 #include <pico/stdlib.h>
 #include <hardware/i2c.h>
 
+/**
+ *	@brief stream frames to the display with DMA (set to 0 where no DMA is available, e.g. host builds)
+ */
+#ifndef SSD1306_USE_DMA
+#define SSD1306_USE_DMA 1
+#endif
+
 /**
  *	@brief defines commands used in ssd1306
  */
@@ -57,19 +64,57 @@ typedef enum
     SET_CHARGE_PUMP = 0x8D
 } ssd1306_command_t;
 
+/**
+ *	@brief maximum number of pages (8 rows each) supported by the controller
+ */
+#define SSD1306_MAX_PAGES 8
+
+/**
+ *	@brief marks a page without pending changes in ssd1306_t::dirty_min
+ */
+#define SSD1306_CLEAN 0xFF
+
+/**
+ *	@brief I2C traffic counters, updated by every write to the display
+ */
+typedef struct
+{
+    uint32_t frame_bytes;        /**< bytes sent by the last ssd1306_show (incl. address and control bytes) */
+    uint32_t frame_transactions; /**< I2C transactions issued by the last ssd1306_show */
+    uint32_t total_bytes;        /**< bytes sent since initialization */
+    uint32_t frames;             /**< calls to ssd1306_show that sent data */
+    uint32_t init_us;            /**< duration of ssd1306_init, command sequence included */
+} ssd1306_stats_t;
+
+/**
+ *	@brief called once the frame passed to ssd1306_show_async has been handed to the I2C controller
+ *
+ *	runs in interrupt context when the transfer uses DMA
+ */
+typedef void (*ssd1306_flush_cb_t)(void *user_data);
+
 /**
  *	@brief holds the configuration
  */
 typedef struct
 {
-    uint8_t width;     /**< width of display */
-    uint8_t height;    /**< height of display */
-    uint8_t pages;     /**< stores pages of display (calculated on initialization*/
-    uint8_t address;   /**< i2c address of display*/
-    i2c_inst_t *i2c_i; /**< i2c connection instance */
-    bool external_vcc; /**< whether display uses external vcc */
-    uint8_t *buffer;   /**< display buffer */
-    size_t bufsize;    /**< buffer size */
+    uint8_t width;                        /**< width of display */
+    uint8_t height;                       /**< height of display */
+    uint8_t pages;                        /**< stores pages of display (calculated on initialization*/
+    uint8_t address;                      /**< i2c address of display*/
+    i2c_inst_t *i2c_i;                    /**< i2c connection instance */
+    bool external_vcc;                    /**< whether display uses external vcc */
+    uint8_t *buffer;                      /**< display buffer */
+    size_t bufsize;                       /**< buffer size */
+    uint8_t dirty_min[SSD1306_MAX_PAGES]; /**< first changed column of each page (SSD1306_CLEAN if unchanged) */
+    uint8_t dirty_max[SSD1306_MAX_PAGES]; /**< last changed column of each page */
+    ssd1306_stats_t stats;                /**< I2C traffic counters */
+    int dma_channel;                      /**< DMA channel used by ssd1306_show_async (-1: blocking writes) */
+    uint16_t *stage;                      /**< front buffer: IC_DATA_CMD words of the frame being transferred */
+    size_t stage_len;                     /**< words staged for the current transfer */
+    size_t stage_cap;                     /**< capacity of stage in words */
+    ssd1306_flush_cb_t flush_cb;          /**< completion callback of the current transfer */
+    void *flush_cb_data;                  /**< argument of flush_cb */
 } ssd1306_t;
 
 /**
@@ -132,11 +177,64 @@ void ssd1306_invert(ssd1306_t *p, uint8_t inv);
 /**
     @brief display buffer, should be called on change
 
+    only the column ranges changed since the last call are sent.
+    blocks until the transfer is over (ssd1306_show_async followed by ssd1306_flush_wait)
+
     @param[in] p : instance of display
 
 */
 void ssd1306_show(ssd1306_t *p);
 
+/**
+    @brief start sending the changed parts of the buffer without waiting for the bus
+
+    the changed bytes are copied to a staging buffer and streamed by DMA, so the
+    display buffer can be drawn on as soon as this returns. waits only if the
+    previous transfer is still running. without a DMA channel it behaves like
+    ssd1306_show and calls cb before returning
+
+    @param[in] p : instance of display
+    @param[in] cb : called when the transfer completes (may be NULL)
+    @param[in] user_data : argument passed to cb
+
+    @return true if a DMA transfer was started
+*/
+bool ssd1306_show_async(ssd1306_t *p, ssd1306_flush_cb_t cb, void *user_data);
+
+/**
+    @brief poll the transfer started by ssd1306_show_async
+
+    @param[in] p : instance of display
+
+    @return true while bytes are still being sent
+*/
+bool ssd1306_flush_busy(ssd1306_t *p);
+
+/**
+    @brief wait for the transfer started by ssd1306_show_async
+
+    @param[in] p : instance of display
+
+*/
+void ssd1306_flush_wait(ssd1306_t *p);
+
+/**
+    @brief mark the whole buffer as changed, so the next ssd1306_show resends it
+
+    @param[in] p : instance of display
+
+*/
+void ssd1306_mark_all_dirty(ssd1306_t *p);
+
+/**
+    @brief check whether the buffer changed since the last ssd1306_show
+
+    @param[in] p : instance of display
+
+    @return true if the next ssd1306_show would send something
+*/
+bool ssd1306_is_dirty(ssd1306_t *p);
+
 /**
     @brief clear display buffer
 
@@ -207,6 +305,35 @@ void ssd1306_draw_square(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t width, u
 */
 void ssd1306_draw_empty_square(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t width, uint32_t height);
 
+/**
+    @brief draw a vertical run of up to 32 pixels in one column
+
+    bit 0 of bits lands on y. set bits are ORed into the buffer, pixels outside
+    the display are clipped
+
+    @param[in] p : instance of display
+    @param[in] x : x position
+    @param[in] y : y position of bit 0
+    @param[in] bits : pixels to set, top to bottom
+*/
+void ssd1306_draw_column(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t bits);
+
+/**
+    @brief copy page-aligned bitmap data into the buffer, replacing its contents
+
+    data holds `pages` rows of `width` bytes in the buffer layout (bit 0 is the top
+    pixel of each byte). only bytes that actually change are marked for the next
+    ssd1306_show
+
+    @param[in] p : instance of display
+    @param[in] x : x position of the first column
+    @param[in] page : first page (row of 8 pixels)
+    @param[in] width : columns per page in data
+    @param[in] pages : pages in data
+    @param[in] data : bitmap data
+*/
+void ssd1306_blit_pages(ssd1306_t *p, uint32_t x, uint32_t page, uint32_t width, uint32_t pages, const uint8_t *data);
+
 /**
     @brief draw monochrome bitmap with offset
 
@@ -0,0 +1,81 @@
+#include "batch.h"
+
+#include <string.h>
+
+/** @brief Limits used when `batch_init` receives no config. */
+static const BATCH_CONFIG_T default_config = {
+    .size = BATCH_SIZE,
+    .max_latency_ms = BATCH_MAX_LATENCY_MS,
+};
+
+void batch_init(BATCH_T *batch, const BATCH_CONFIG_T *config)
+{
+    batch->config = config ? *config : default_config;
+
+    if (batch->config.size == 0)
+        batch->config.size = 1;
+    if (batch->config.size > BATCH_CAPACITY)
+        batch->config.size = BATCH_CAPACITY;
+
+    batch->count = 0;
+    batch->first_us = 0;
+    batch->requests = 0;
+    batch->readings = 0;
+    batch->overflows = 0;
+}
+
+void batch_add(BATCH_T *batch, const SENSOR_DATA_T *reading, uint64_t capture_us)
+{
+    if (batch->count == BATCH_CAPACITY)
+    { // Nothing could be sent for a while: keep the newest readings
+        memmove(&batch->entries[0], &batch->entries[1], (BATCH_CAPACITY - 1) * sizeof(BATCH_ENTRY_T));
+        batch->count--;
+        batch->overflows++;
+        batch->first_us = batch->entries[0].capture_us;
+    }
+
+    if (batch->count == 0)
+        batch->first_us = capture_us;
+
+    BATCH_ENTRY_T *entry = &batch->entries[batch->count++];
+    entry->reading = *reading;
+    entry->capture_us = capture_us;
+}
+
+bool batch_full(const BATCH_T *batch)
+{
+    return batch->count >= batch->config.size;
+}
+
+bool batch_due(const BATCH_T *batch, uint64_t now_us)
+{
+    if (batch->count == 0)
+        return false;
+    return batch_full(batch) || now_us >= batch_deadline_us(batch);
+}
+
+uint64_t batch_deadline_us(const BATCH_T *batch)
+{
+    if (batch->count == 0)
+        return UINT64_MAX;
+    return batch->first_us + (uint64_t)batch->config.max_latency_ms * 1000;
+}
+
+void batch_sent(BATCH_T *batch)
+{
+    batch->requests++;
+    batch->readings += batch->count;
+    batch->count = 0;
+}
+
+void batch_clear(BATCH_T *batch)
+{
+    batch->count = 0;
+}
+
+uint32_t batch_readings_per_request_centi(const BATCH_T *batch)
+{
+    if (batch->requests == 0)
+        return 0;
+    return (uint32_t)((uint64_t)batch->readings * 100 / batch->requests);
+}
@@ -0,0 +1,118 @@
+/**
+ * @file batch.h
+ * @brief Accumulates published readings so several go in one request.
+ *
+ * Readings are stored with their capture time in a static buffer. The batch
+ * is due once it holds `size` readings or its oldest reading is
+ * `max_latency_ms` old, whichever comes first; the caller then serializes it
+ * and clears it with `batch_sent`.
+ */
+
+#ifndef BATCH_H
+#define BATCH_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "readings.h"
+
+/** @brief Capacity of the batch buffer (largest configurable batch size). */
+#define BATCH_CAPACITY 16
+/** @brief Default number of readings per request. */
+#define BATCH_SIZE 8
+/** @brief Default maximum time a reading waits in the batch. */
+#define BATCH_MAX_LATENCY_MS 1000
+
+/**
+ * @brief Batch limits.
+ */
+typedef struct
+{
+    uint8_t size;            ///< Readings that make a batch due (1 to BATCH_CAPACITY).
+    uint32_t max_latency_ms; ///< Age of the oldest reading that makes a batch due.
+} BATCH_CONFIG_T;
+
+/**
+ * @brief One buffered reading.
+ */
+typedef struct
+{
+    SENSOR_DATA_T reading; ///< Reading as published.
+    uint64_t capture_us;   ///< Capture time (`time_us_64()` when the sensors were read).
+} BATCH_ENTRY_T;
+
+/**
+ * @brief Batch buffer and counters.
+ */
+typedef struct
+{
+    BATCH_CONFIG_T config;                  ///< Active limits.
+    BATCH_ENTRY_T entries[BATCH_CAPACITY];  ///< Buffered readings, oldest first.
+    uint8_t count;                          ///< Readings in `entries`.
+    uint64_t first_us;                      ///< Capture time of the oldest buffered reading.
+    uint32_t requests;                      ///< Batches sent.
+    uint32_t readings;                      ///< Readings sent in those batches.
+    uint32_t overflows;                     ///< Readings dropped because the buffer was full.
+} BATCH_T;
+
+/**
+ * @brief Initializes an empty batch.
+ * @param batch Batch to initialize.
+ * @param config Limits, or NULL for the BATCH_* defaults.
+ */
+void batch_init(BATCH_T *batch, const BATCH_CONFIG_T *config);
+
+/**
+ * @brief Appends a reading.
+ *
+ * If the buffer is already at BATCH_CAPACITY (the previous batch could not be
+ * sent), the oldest reading is dropped and counted in `overflows`.
+ *
+ * @param batch Batch state.
+ * @param reading Reading to buffer (copied).
+ * @param capture_us Capture time (`time_us_64()` when the sensors were read).
+ */
+void batch_add(BATCH_T *batch, const SENSOR_DATA_T *reading, uint64_t capture_us);
+
+/**
+ * @brief Checks whether the batch reached its size or latency limit.
+ * @param batch Batch state.
+ * @param now_us Current time.
+ * @return true if the batch should be sent now.
+ */
+bool batch_due(const BATCH_T *batch, uint64_t now_us);
+
+/**
+ * @brief Checks whether the batch reached its size limit.
+ * @param batch Batch state.
+ * @return true if no more readings should wait for this batch.
+ */
+bool batch_full(const BATCH_T *batch);
+
+/**
+ * @brief Time at which the batch becomes due by age, for sleeping until then.
+ * @param batch Batch state.
+ * @return Absolute time in microseconds, or UINT64_MAX if the batch is empty.
+ */
+uint64_t batch_deadline_us(const BATCH_T *batch);
+
+/**
+ * @brief Empties the batch after it was handed to the network and counts it.
+ * @param batch Batch state.
+ */
+void batch_sent(BATCH_T *batch);
+
+/**
+ * @brief Empties the batch without counting a request (readings moved elsewhere).
+ * @param batch Batch state.
+ */
+void batch_clear(BATCH_T *batch);
+
+/**
+ * @brief Average readings carried per request, for telemetry.
+ * @param batch Batch state.
+ * @return Readings per request in hundredths (0 before the first request).
+ */
+uint32_t batch_readings_per_request_centi(const BATCH_T *batch);
+
+#endif
@@ -0,0 +1,81 @@
+#include "change_detector.h"
+
+#include <stdlib.h>
+
+/** @brief Thresholds used when `change_detector_init` receives no config. */
+static const CHANGE_DETECTOR_CONFIG_T default_config = {
+    .joystick_deadband = CHANGE_JOYSTICK_DEADBAND,
+    .temperature_deadband = CHANGE_TEMPERATURE_DEADBAND,
+    .heartbeat_ms = CHANGE_HEARTBEAT_MS,
+    .min_interval_ms = CHANGE_MIN_INTERVAL_MS,
+};
+
+void change_detector_init(CHANGE_DETECTOR_T *detector, const CHANGE_DETECTOR_CONFIG_T *config)
+{
+    detector->config = config ? *config : default_config;
+    detector->has_last = false;
+    detector->last_publish_us = 0;
+    detector->published = 0;
+    detector->suppressed = 0;
+    detector->heartbeats = 0;
+}
+
+/**
+ * @brief Compares a reading with the last published snapshot.
+ * @return true if any field moved past its deadband (or changed, for discrete fields).
+ */
+static bool change_detector_differs(const CHANGE_DETECTOR_T *detector, const SENSOR_DATA_T *reading)
+{
+    const CHANGE_DETECTOR_CONFIG_T *config = &detector->config;
+    const SENSOR_DATA_T *last = &detector->last;
+
+    if (reading->button_a != last->button_a || reading->button_b != last->button_b)
+        return true;
+    if (reading->direction != last->direction)
+        return true;
+    if (abs(reading->analog_x - last->analog_x) > config->joystick_deadband ||
+        abs(reading->analog_y - last->analog_y) > config->joystick_deadband)
+        return true;
+    return abs(reading->temperature - last->temperature) > config->temperature_deadband;
+}
+
+bool change_detector_check(CHANGE_DETECTOR_T *detector, const SENSOR_DATA_T *reading, uint64_t now_us)
+{
+    uint64_t silence_ms = (now_us - detector->last_publish_us) / 1000;
+    bool publish;
+
+    if (!detector->has_last)
+    {
+        publish = true;
+    }
+    else if (silence_ms < detector->config.min_interval_ms)
+    {
+        // Anything still different once the interval expires is published then.
+        publish = false;
+    }
+    else if (change_detector_differs(detector, reading))
+    {
+        publish = true;
+    }
+    else if (silence_ms >= detector->config.heartbeat_ms)
+    {
+        publish = true;
+        detector->heartbeats++;
+    }
+    else
+    {
+        publish = false;
+    }
+
+    if (!publish)
+    {
+        detector->suppressed++;
+        return false;
+    }
+
+    detector->last = *reading;
+    detector->has_last = true;
+    detector->last_publish_us = now_us;
+    detector->published++;
+    return true;
+}
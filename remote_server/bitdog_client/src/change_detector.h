@@ -0,0 +1,74 @@
+/**
+ * @file change_detector.h
+ * @brief Decides when a reading is worth publishing.
+ *
+ * A reading is published only when it differs meaningfully from the last
+ * published one (joystick beyond a deadband, new wind rose direction, button
+ * edge, temperature beyond a deadband) or when the server has not heard from
+ * the device for `heartbeat_ms`. Suppressed and published readings are counted
+ * so the bandwidth savings can be checked on idle boards.
+ */
+
+#ifndef CHANGE_DETECTOR_H
+#define CHANGE_DETECTOR_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "readings.h"
+
+/** @brief Default joystick deadband per axis (5% of full scale). */
+#define CHANGE_JOYSTICK_DEADBAND 1638
+/** @brief Default temperature deadband (hundredths of °C). */
+#define CHANGE_TEMPERATURE_DEADBAND 100
+/** @brief Default maximum silence before a heartbeat publication. */
+#define CHANGE_HEARTBEAT_MS 30000
+/** @brief Default minimum spacing between two publications. */
+#define CHANGE_MIN_INTERVAL_MS 200
+
+/**
+ * @brief Change detector thresholds.
+ */
+typedef struct
+{
+    int16_t joystick_deadband;    ///< Minimum change on either axis (same scale as the axes).
+    int16_t temperature_deadband; ///< Minimum temperature change (hundredths of °C).
+    uint32_t heartbeat_ms;        ///< Publish at least this often, even without changes.
+    uint32_t min_interval_ms;     ///< Never publish more often than this.
+} CHANGE_DETECTOR_CONFIG_T;
+
+/**
+ * @brief Change detector state and counters.
+ */
+typedef struct
+{
+    CHANGE_DETECTOR_CONFIG_T config; ///< Active thresholds.
+    SENSOR_DATA_T last;              ///< Last published snapshot.
+    bool has_last;                   ///< Whether `last` holds a published snapshot.
+    uint64_t last_publish_us;        ///< Time of the last publication.
+    uint32_t published;              ///< Readings that triggered a publication.
+    uint32_t suppressed;             ///< Readings dropped as unchanged.
+    uint32_t heartbeats;             ///< Publications triggered only by the heartbeat.
+} CHANGE_DETECTOR_T;
+
+/**
+ * @brief Initializes the detector.
+ * @param detector Detector to initialize.
+ * @param config Thresholds, or NULL for the CHANGE_* defaults.
+ */
+void change_detector_init(CHANGE_DETECTOR_T *detector, const CHANGE_DETECTOR_CONFIG_T *config);
+
+/**
+ * @brief Checks a new reading against the last published one.
+ *
+ * When it returns true the reading is recorded as published; otherwise it is
+ * counted as suppressed.
+ *
+ * @param detector Detector state.
+ * @param reading New reading.
+ * @param now_us Current time (`time_us_64()`).
+ * @return true if the reading should be published.
+ */
+bool change_detector_check(CHANGE_DETECTOR_T *detector, const SENSOR_DATA_T *reading, uint64_t now_us);
+
+#endif
@@ -0,0 +1,42 @@
+#include "console.h"
+
+#include <stdio.h>
+
+#include "pico/stdlib.h"
+
+void console_init(CONSOLE_T *console)
+{
+    console->len = 0;
+    console->overflow = false;
+}
+
+const char *console_poll(CONSOLE_T *console)
+{
+    int c;
+    while ((c = getchar_timeout_us(0)) != PICO_ERROR_TIMEOUT)
+    {
+        if (c == '\r' || c == '\n')
+        {
+            bool complete = console->len > 0 && !console->overflow;
+            console->line[console->len] = '\0';
+            console->len = 0;
+            if (console->overflow)
+                printf("Linha longa demais, ignorada\n");
+            console->overflow = false;
+            if (complete)
+                return console->line;
+            continue;
+        }
+
+        if (c == '\b' || c == 0x7F)
+        {
+            if (console->len > 0)
+                console->len--;
+        }
+        else if (console->len < CONSOLE_LINE_MAX - 1)
+            console->line[console->len++] = (char)c;
+        else
+            console->overflow = true;
+    }
+    return NULL;
+}
@@ -0,0 +1,42 @@
+/**
+ * @file console.h
+ * @brief Non-blocking line input from the serial console (USB or UART stdio).
+ *
+ * Characters are read as they are available, without waiting, and gathered
+ * into a line; a line ends at CR or LF. Backspace erases the last character
+ * and a line longer than CONSOLE_LINE_MAX is discarded.
+ */
+
+#ifndef CONSOLE_H
+#define CONSOLE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/** @brief Longest line, including the terminator. */
+#define CONSOLE_LINE_MAX 96
+
+/**
+ * @brief Line being typed.
+ */
+typedef struct
+{
+    char line[CONSOLE_LINE_MAX]; ///< Characters typed so far.
+    uint8_t len;                 ///< Length of `line`.
+    bool overflow;               ///< The line got too long; it is dropped at its end.
+} CONSOLE_T;
+
+/**
+ * @brief Starts with an empty line.
+ * @param console Console state.
+ */
+void console_init(CONSOLE_T *console);
+
+/**
+ * @brief Reads the characters available on stdin.
+ * @param console Console state.
+ * @return The complete line (valid until the next call), or NULL if none ended yet.
+ */
+const char *console_poll(CONSOLE_T *console);
+
+#endif
@@ -1,11 +1,34 @@
 #include "display.h"
 
+#include <string.h>
+
 ssd1306_t display;
 uint8_t global_display_x = 0;
 uint8_t global_display_y = 0;
 
-/// Espaçamento entre linhas no display
-const uint8_t line_spacing = 3;
+/// Tela retida desenhada atualmente
+static uint8_t current_screen = DISPLAY_SCREEN_NONE;
+
+/// Campos dinâmicos da tela retida
+static display_field_t fields[DISPLAY_MAX_FIELDS];
+
+/// Quantidade de campos em uso
+static uint8_t field_count = 0;
+
+/// Intervalo mínimo entre quadros apresentados
+static uint32_t frame_interval_us = 1000000 / DISPLAY_MAX_FPS;
+
+/// Instante do último quadro apresentado
+static uint64_t last_present_us = 0;
+
+/// Há um pedido de apresentação não atendido
+static bool present_pending = false;
+
+/// O pedido pendente já foi contado como adiado
+static bool pending_counted = false;
+
+/// Estatísticas do compositor
+static display_stats_t stats;
 
 /**
  * @brief Inicializa o barramento I2C para o display.
@@ -37,6 +60,9 @@ int init_display()
         return PICO_ERROR_GENERIC;
     }
 
+    printf("Display iniciado em %lu us (%lu bytes de comandos)\n",
+           (unsigned long)display.stats.init_us, (unsigned long)display.stats.total_bytes);
+
     show("Iniciando...", true);
     clear_display(true);
     return PICO_OK;
@@ -51,6 +77,7 @@ int init_display()
  */
 void clear_display(bool reset_screen)
 {
+    current_screen = DISPLAY_SCREEN_NONE;
     ssd1306_clear(&display);
     show("==================", false);
 
@@ -65,18 +92,186 @@ void clear_display(bool reset_screen)
  * @brief Desenha uma string no display.
  *
  * A string será posicionada verticalmente conforme o valor atual de `global_display_y`.
- * Se `render_now` for verdadeiro, a tela será atualizada imediatamente.
+ * Se `render_now` for verdadeiro, o quadro é entregue ao compositor, que o
+ * envia por DMA respeitando o limite de quadros por segundo.
  *
  * @param text Texto a ser exibido.
  * @param render_now Se verdadeiro, atualiza a tela após desenhar.
  */
 void show(const char *text, bool render_now)
 {
-    ssd1306_draw_string(&display, 0, global_display_y, 1, text);
-    global_display_y += line_spacing * 5;
+    current_screen = DISPLAY_SCREEN_NONE;
+    text_draw(&display, &font_small, 0, global_display_y, text);
+    global_display_y += DISPLAY_LINE_HEIGHT;
 
     if (render_now)
     {
-        ssd1306_show(&display);
+        display_render();
     }
 }
+
+/**
+ * @brief Inicia a construção de uma tela retida.
+ *
+ * @param screen_id Identificador da tela.
+ * @return true se a tela precisa ser construída pelo chamador.
+ */
+bool display_screen_begin(uint8_t screen_id)
+{
+    if (screen_id == current_screen)
+        return false;
+
+    ssd1306_clear(&display);
+    field_count = 0;
+    current_screen = screen_id;
+    return true;
+}
+
+/**
+ * @brief Desenha um rótulo estático.
+ *
+ * @param x Coluna do texto.
+ * @param y Linha do texto.
+ * @param text Texto do rótulo.
+ */
+void display_label(uint8_t x, uint8_t y, const char *text)
+{
+    text_draw(&display, &font_small, x, y, text);
+}
+
+/**
+ * @brief Cria um campo dinâmico vazio.
+ *
+ * @return Índice do campo, ou -1 se todos estiverem em uso.
+ */
+int display_field(uint8_t x, uint8_t page, uint8_t width, const font_t *font, text_align_t align)
+{
+    if (field_count >= DISPLAY_MAX_FIELDS)
+        return -1;
+
+    display_field_t *field = &fields[field_count];
+    field->x = x;
+    field->page = page;
+    field->width = width;
+    field->align = align;
+    field->font = font;
+    field->text[0] = '\0';
+    return field_count++;
+}
+
+/**
+ * @brief Redesenha um campo se o texto mudou.
+ *
+ * @param field Índice do campo.
+ * @param text Novo texto.
+ */
+void display_field_set(int field, const char *text)
+{
+    if (field < 0 || field >= field_count)
+        return;
+
+    display_field_t *f = &fields[field];
+    if (strncmp(f->text, text, sizeof(f->text) - 1) == 0)
+        return;
+
+    strncpy(f->text, text, sizeof(f->text) - 1);
+    f->text[sizeof(f->text) - 1] = '\0';
+    text_draw_box(&display, f->font, f->x, f->page, f->width, f->align, f->text);
+}
+
+/**
+ * @brief Envia o quadro ao display e atualiza as estatísticas.
+ */
+static void present(uint64_t now_us)
+{
+    if (last_present_us)
+        stats.interval_us = now_us - last_present_us;
+    last_present_us = now_us;
+
+    ssd1306_show_async(&display, NULL, NULL);
+
+    stats.frame_us = time_us_64() - now_us;
+    if (stats.frame_us > stats.max_frame_us)
+        stats.max_frame_us = stats.frame_us;
+    stats.presented++;
+    present_pending = false;
+    pending_counted = false;
+}
+
+/**
+ * @brief Pede a apresentação do quadro atual.
+ */
+void display_render()
+{
+    present_pending = true;
+    display_tick();
+}
+
+/**
+ * @brief Apresenta o quadro pendente se o intervalo mínimo já passou.
+ *
+ * @return true se um quadro foi enviado.
+ */
+bool display_tick()
+{
+    if (!present_pending)
+        return false;
+
+    if (!ssd1306_is_dirty(&display))
+    {
+        stats.skipped++;
+        present_pending = false;
+        pending_counted = false;
+        return false;
+    }
+
+    uint64_t now_us = time_us_64();
+    if (last_present_us && now_us - last_present_us < frame_interval_us)
+    {
+        if (!pending_counted)
+        {
+            stats.deferred++;
+            pending_counted = true;
+        }
+        return false;
+    }
+
+    present(now_us);
+    return true;
+}
+
+/**
+ * @brief Apresenta o quadro atual imediatamente e espera o envio.
+ */
+void display_flush()
+{
+    if (ssd1306_is_dirty(&display))
+        present(time_us_64());
+    else
+        present_pending = false;
+    ssd1306_flush_wait(&display);
+}
+
+/**
+ * @brief Instante em que o pedido pendente poderá ser atendido.
+ */
+uint64_t display_next_present_us()
+{
+    return present_pending ? last_present_us + frame_interval_us : UINT64_MAX;
+}
+
+/**
+ * @brief Altera o limite de quadros por segundo.
+ */
+void display_set_max_fps(uint8_t fps)
+{
+    frame_interval_us = 1000000 / (fps ? fps : DISPLAY_MAX_FPS);
+}
+
+/**
+ * @brief Estatísticas do compositor.
+ */
+const display_stats_t *display_get_stats()
+{
+    return &stats;
+}
@@ -0,0 +1,74 @@
+/**
+ * @file storage.h
+ * @brief Interface para persistência de pequenos registros na flash do RP2040.
+ *
+ * Os últimos setores da flash são reservados para configurações do dispositivo
+ * (calibrações, parâmetros de rede etc.). Cada registro ocupa um setor próprio
+ * ("slot") e é gravado com cabeçalho e CRC, de modo que um setor apagado ou
+ * corrompido é detectado na leitura e o módulo chamador volta aos valores padrão.
+ */
+
+#ifndef STORAGE_H
+#define STORAGE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hardware/flash.h"
+
+/// Slot com a calibração do joystick
+#define STORAGE_SLOT_JOYSTICK 0
+
+/// Slot com a calibração de dois pontos do sensor de temperatura
+#define STORAGE_SLOT_TEMP 1
+
+/// Slot com o endereço do servidor de leituras (bitdog_client)
+#define STORAGE_SLOT_SERVER 2
+
+/// Slot com o perfil de economia de energia do Wi-Fi (modo estação)
+#define STORAGE_SLOT_WIFI_PM 3
+
+/// Quantidade de setores reservados para slots no fim da flash
+#define STORAGE_SLOT_COUNT 4
+
+/// Bytes reservados no fim da flash para os slots (outras regiões ficam abaixo deste limite)
+#define STORAGE_RESERVED_BYTES (STORAGE_SLOT_COUNT * FLASH_SECTOR_SIZE)
+
+/// Tamanho máximo do conteúdo de um registro (uma página menos o cabeçalho)
+#define STORAGE_MAX_RECORD_SIZE (FLASH_PAGE_SIZE - 8)
+
+/**
+ * @brief Lê um registro salvo na flash.
+ *
+ * @param slot Slot a ser lido (STORAGE_SLOT_*).
+ * @param data Destino do conteúdo.
+ * @param len Tamanho esperado do registro.
+ * @return true se o registro existe, tem o tamanho esperado e o CRC confere.
+ */
+bool storage_load(uint8_t slot, void *data, size_t len);
+
+/**
+ * @brief Grava um registro na flash, substituindo o conteúdo anterior do slot.
+ *
+ * Apaga o setor do slot e programa uma página. As interrupções ficam
+ * bloqueadas durante a operação (alguns milissegundos), portanto não deve ser
+ * chamada no laço principal a cada iteração.
+ *
+ * @param slot Slot a ser gravado (STORAGE_SLOT_*).
+ * @param data Conteúdo a ser gravado.
+ * @param len Tamanho do conteúdo (até STORAGE_MAX_RECORD_SIZE).
+ * @return true em caso de sucesso.
+ */
+bool storage_save(uint8_t slot, const void *data, size_t len);
+
+/**
+ * @brief Calcula o CRC-16/CCITT de um bloco de dados.
+ *
+ * @param data Dados de entrada.
+ * @param len Quantidade de bytes.
+ * @return CRC calculado.
+ */
+uint16_t storage_crc16(const void *data, size_t len);
+
+#endif
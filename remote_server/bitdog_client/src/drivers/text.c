@@ -0,0 +1,90 @@
+#include "text.h"
+
+#include <string.h>
+
+/**
+ * @brief Retorna o glifo de um caractere ('?' para caracteres fora da fonte).
+ */
+static const font_glyph_t *glyph_of(const font_t *font, char c)
+{
+    uint8_t code = (uint8_t)c;
+
+    if (code < font->first || code > font->last)
+        code = '?' >= font->first && '?' <= font->last ? '?' : font->first;
+    return &font->glyphs[code - font->first];
+}
+
+uint32_t text_width(const font_t *font, const char *text)
+{
+    uint32_t width = 0;
+
+    for (; *text; ++text)
+    {
+        width += glyph_of(font, *text)->width;
+        if (text[1])
+            width += font->spacing;
+    }
+    return width;
+}
+
+void text_draw(ssd1306_t *p, const font_t *font, int32_t x, uint32_t y, const char *text)
+{
+    for (; *text && x < (int32_t)p->width; ++text)
+    {
+        const font_glyph_t *glyph = glyph_of(font, *text);
+        const uint8_t *data = font->data + glyph->offset;
+
+        for (uint32_t col = 0; col < glyph->width; ++col)
+        {
+            if (x + (int32_t)col < 0)
+                continue;
+
+            // junta as páginas da coluna num único valor e o desenha de uma vez
+            uint32_t bits = 0;
+            for (uint32_t page = 0; page < font->pages; ++page)
+                bits |= (uint32_t)data[page * glyph->width + col] << (8 * page);
+
+            if (bits)
+                ssd1306_draw_column(p, x + col, y, bits);
+        }
+
+        x += glyph->width + font->spacing;
+    }
+}
+
+void text_draw_box(ssd1306_t *p, const font_t *font, uint8_t x, uint8_t page, uint8_t width, text_align_t align, const char *text)
+{
+    uint8_t box[TEXT_MAX_PAGES * 128];
+    uint32_t pages = font->pages < TEXT_MAX_PAGES ? font->pages : TEXT_MAX_PAGES;
+
+    if (width > 128)
+        width = 128;
+    memset(box, 0, pages * width);
+
+    int32_t text_w = text_width(font, text);
+    int32_t col = 0;
+    if (align == TEXT_ALIGN_RIGHT)
+        col = width - text_w;
+    else if (align == TEXT_ALIGN_CENTER)
+        col = (width - text_w) / 2;
+
+    for (; *text && col < width; ++text)
+    {
+        const font_glyph_t *glyph = glyph_of(font, *text);
+        const uint8_t *data = font->data + glyph->offset;
+
+        for (uint32_t i = 0; i < glyph->width; ++i)
+        {
+            int32_t bx = col + (int32_t)i;
+            if (bx < 0 || bx >= width)
+                continue;
+
+            for (uint32_t k = 0; k < pages; ++k)
+                box[k * width + bx] = data[k * glyph->width + i];
+        }
+
+        col += glyph->width + font->spacing;
+    }
+
+    ssd1306_blit_pages(p, x, page, width, pages, box);
+}
@@ -0,0 +1,66 @@
+/**
+ * @file text.h
+ * @brief Desenho de texto com as fontes proporcionais de fonts.h.
+ */
+
+#ifndef TEXT_H
+#define TEXT_H
+
+#include <stdint.h>
+
+#include "ssd1306.h"
+#include "fonts.h"
+
+/// Maior quantidade de páginas de uma fonte suportada por text_draw_box()
+#define TEXT_MAX_PAGES 3
+
+/**
+ * @brief Alinhamento horizontal do texto dentro de uma caixa.
+ */
+typedef enum
+{
+    TEXT_ALIGN_LEFT,   ///< Encostado à esquerda
+    TEXT_ALIGN_RIGHT,  ///< Encostado à direita (números)
+    TEXT_ALIGN_CENTER, ///< Centralizado
+} text_align_t;
+
+/**
+ * @brief Calcula a largura de um texto em pixels.
+ *
+ * @param font Fonte usada.
+ * @param text Texto.
+ * @return Largura, sem o espaçamento após o último glifo.
+ */
+uint32_t text_width(const font_t *font, const char *text);
+
+/**
+ * @brief Desenha um texto sobre o conteúdo atual (pixels apagados do glifo não apagam nada).
+ *
+ * Funciona em qualquer linha y; o que sair da tela é recortado.
+ *
+ * @param p Display.
+ * @param font Fonte usada.
+ * @param x Coluna do primeiro glifo (pode ser negativa).
+ * @param y Linha do topo do texto.
+ * @param text Texto.
+ */
+void text_draw(ssd1306_t *p, const font_t *font, int32_t x, uint32_t y, const char *text);
+
+/**
+ * @brief Desenha um texto numa caixa alinhada a páginas, substituindo o fundo.
+ *
+ * A caixa inteira (largura `width`, altura de `font->pages` páginas) é
+ * composta fora da tela e copiada de uma vez; o texto é recortado nas bordas
+ * da caixa e apenas os bytes que mudaram são enviados ao display.
+ *
+ * @param p Display.
+ * @param font Fonte usada (até TEXT_MAX_PAGES páginas).
+ * @param x Coluna da caixa.
+ * @param page Página do topo da caixa.
+ * @param width Largura da caixa em pixels.
+ * @param align Alinhamento do texto na caixa.
+ * @param text Texto.
+ */
+void text_draw_box(ssd1306_t *p, const font_t *font, uint8_t x, uint8_t page, uint8_t width, text_align_t align, const char *text);
+
+#endif
@@ -1,5 +1,13 @@
 #include "wifi.h"
 
+#include <stdio.h>
+#include <string.h>
+
+#include "lwip/netif.h"
+
+/// Supervisor registrado (o callback de enlace do lwIP não recebe argumento)
+static wifi_supervisor_t *supervisor;
+
 void init_wifi_ap()
 {
     // Initialise the Wi-Fi chip
@@ -42,4 +50,206 @@ void connect_to_wifi()
         uint8_t *ip_address = (uint8_t *)&(cyw43_state.netif[0].ip_addr.addr);
         printf("IP address %d.%d.%d.%d\n", ip_address[0], ip_address[1], ip_address[2], ip_address[3]);
     }
-}
\ No newline at end of file
+}
+
+static const char *wifi_state_names[] = {"fora", "varrendo", "associando", "conectado"};
+
+const char *wifi_state_name(wifi_state_t state)
+{
+    return state < sizeof(wifi_state_names) / sizeof(wifi_state_names[0]) ? wifi_state_names[state] : "?";
+}
+
+/**
+ * @brief Callback de enlace do lwIP: marca a queda no instante em que ocorre.
+ */
+static void wifi_link_callback(struct netif *netif)
+{
+    if (supervisor && supervisor->state == WIFI_STATE_UP && !netif_is_link_up(netif))
+    {
+        supervisor->link_lost = true;
+        supervisor->down_us = time_us_64();
+    }
+}
+
+/**
+ * @brief Guarda o ponto de acesso da rede com o melhor sinal encontrado na varredura.
+ */
+static int wifi_scan_result(void *env, const cyw43_ev_scan_result_t *result)
+{
+    wifi_supervisor_t *wifi = (wifi_supervisor_t *)env;
+
+    if (!result || result->ssid_len != strlen(WIFI_SSID) || memcmp(result->ssid, WIFI_SSID, result->ssid_len) != 0)
+        return 0;
+
+    if (!wifi->scan_found || result->rssi > wifi->scan_rssi)
+    {
+        memcpy(wifi->bssid, result->bssid, sizeof(wifi->bssid));
+        wifi->channel = result->channel;
+        wifi->scan_rssi = result->rssi;
+        wifi->scan_found = true;
+    }
+    return 0;
+}
+
+/**
+ * @brief Encerra uma tentativa frustrada e agenda a próxima.
+ */
+static void wifi_attempt_failed(wifi_supervisor_t *wifi, uint64_t now_us, int status)
+{
+    printf("Wi-Fi: tentativa falhou (%d)\n", status);
+    wifi->failures++;
+    wifi->state = WIFI_STATE_DOWN;
+
+    if (wifi->fast_join)
+    { // O ponto de acesso pode ter mudado de canal ou saído do ar: varre de novo já
+        wifi->cached = false;
+        wifi->fast_join = false;
+        wifi->next_us = now_us;
+        return;
+    }
+
+    uint8_t shift = wifi->failures_in_row < 5 ? wifi->failures_in_row : 5;
+    uint32_t backoff_ms = (uint32_t)WIFI_BACKOFF_MIN_MS << shift;
+    if (backoff_ms > WIFI_BACKOFF_MAX_MS)
+        backoff_ms = WIFI_BACKOFF_MAX_MS;
+    wifi->failures_in_row++;
+    wifi->next_us = now_us + (uint64_t)backoff_ms * 1000;
+}
+
+/**
+ * @brief Pede a associação; com `targeted`, direto ao BSSID e canal em cache.
+ */
+static void wifi_join(wifi_supervisor_t *wifi, uint64_t now_us, bool targeted)
+{
+    int err = cyw43_wifi_join(&cyw43_state, strlen(WIFI_SSID), (const uint8_t *)WIFI_SSID, strlen(WIFI_PASSWORD),
+                              (const uint8_t *)WIFI_PASSWORD, CYW43_AUTH_WPA2_AES_PSK, targeted ? wifi->bssid : NULL,
+                              targeted ? wifi->channel : CYW43_CHANNEL_NONE);
+    if (err)
+    {
+        wifi_attempt_failed(wifi, now_us, err);
+        return;
+    }
+    wifi->state = WIFI_STATE_JOINING;
+    wifi->next_us = now_us + WIFI_POLL_INTERVAL_MS * 1000ull;
+}
+
+/**
+ * @brief Inicia uma tentativa: pelo cache, se houver, ou por uma varredura.
+ */
+static void wifi_start_attempt(wifi_supervisor_t *wifi, uint64_t now_us)
+{
+    cyw43_wifi_leave(&cyw43_state, CYW43_ITF_STA); // Descarta o que restou da associação anterior
+    wifi->attempt_us = now_us;
+    wifi->attempts++;
+
+    if (wifi->cached)
+    {
+        wifi->fast_join = true;
+        wifi_join(wifi, now_us, true);
+        return;
+    }
+
+    wifi->fast_join = false;
+    wifi->scan_found = false;
+    cyw43_wifi_scan_options_t options = {0};
+    if (cyw43_wifi_scan(&cyw43_state, &options, wifi, wifi_scan_result) != 0)
+    {
+        wifi_join(wifi, now_us, false); // Sem varredura, a associação comum procura em todos os canais
+        return;
+    }
+    wifi->state = WIFI_STATE_SCANNING;
+    wifi->next_us = now_us + WIFI_POLL_INTERVAL_MS * 1000ull;
+}
+
+/**
+ * @brief Registra a conexão obtida e as métricas da tentativa e da queda.
+ */
+static void wifi_connected(wifi_supervisor_t *wifi, uint64_t now_us)
+{
+    wifi->last_reconnect_ms = (uint32_t)((now_us - wifi->attempt_us) / 1000);
+    if (wifi->last_reconnect_ms > wifi->max_reconnect_ms)
+        wifi->max_reconnect_ms = wifi->last_reconnect_ms;
+    if (wifi->disconnects > 0) // A espera do boot até a primeira conexão não é queda
+    {
+        wifi->last_downtime_ms = (uint32_t)((now_us - wifi->down_us) / 1000);
+        wifi->total_downtime_ms += wifi->last_downtime_ms;
+    }
+    if (wifi->fast_join)
+        wifi->fast_joins++;
+
+    wifi->state = WIFI_STATE_UP;
+    wifi->failures_in_row = 0;
+    wifi->link_lost = false;
+
+    printf("Wi-Fi: conectado em %lu ms (%s, canal %u), IP %s\n", (unsigned long)wifi->last_reconnect_ms,
+           wifi->fast_join ? "cache" : "varredura", wifi->cached ? wifi->channel : 0,
+           ipaddr_ntoa(&cyw43_state.netif[CYW43_ITF_STA].ip_addr));
+}
+
+void wifi_supervisor_init(wifi_supervisor_t *wifi)
+{
+    memset(wifi, 0, sizeof(*wifi));
+    wifi->state = WIFI_STATE_DOWN;
+    wifi->down_us = time_us_64();
+    wifi->next_us = wifi->down_us; // A primeira tentativa começa no primeiro poll
+
+    supervisor = wifi;
+    netif_set_link_callback(&cyw43_state.netif[CYW43_ITF_STA], wifi_link_callback);
+}
+
+void wifi_supervisor_poll(wifi_supervisor_t *wifi, uint64_t now_us)
+{
+    switch (wifi->state)
+    {
+    case WIFI_STATE_UP:
+        if (!wifi->link_lost && cyw43_tcpip_link_status(&cyw43_state, CYW43_ITF_STA) == CYW43_LINK_UP)
+            return;
+        if (!wifi->link_lost)
+            wifi->down_us = now_us; // Perda do IP, sem queda do enlace
+        printf("Wi-Fi: conexão perdida\n");
+        wifi->disconnects++;
+        wifi->state = WIFI_STATE_DOWN;
+        wifi->next_us = now_us; // A primeira tentativa é imediata (pelo cache)
+        break;
+
+    case WIFI_STATE_DOWN:
+        if (now_us >= wifi->next_us)
+            wifi_start_attempt(wifi, now_us);
+        break;
+
+    case WIFI_STATE_SCANNING:
+        if (cyw43_wifi_scan_active(&cyw43_state))
+        {
+            if (now_us - wifi->attempt_us >= WIFI_TIMEOUT_MS * 1000ull)
+                wifi_attempt_failed(wifi, now_us, CYW43_LINK_NONET);
+            else
+                wifi->next_us = now_us + WIFI_POLL_INTERVAL_MS * 1000ull;
+            break;
+        }
+        wifi->cached = wifi->scan_found;
+        wifi_join(wifi, now_us, wifi->scan_found);
+        break;
+
+    case WIFI_STATE_JOINING:
+    {
+        int status = cyw43_tcpip_link_status(&cyw43_state, CYW43_ITF_STA);
+        if (status == CYW43_LINK_UP)
+            wifi_connected(wifi, now_us);
+        else if (status < 0 || now_us - wifi->attempt_us >= WIFI_TIMEOUT_MS * 1000ull)
+            wifi_attempt_failed(wifi, now_us, status);
+        else
+            wifi->next_us = now_us + WIFI_POLL_INTERVAL_MS * 1000ull;
+        break;
+    }
+    }
+}
+
+bool wifi_supervisor_online(const wifi_supervisor_t *wifi)
+{
+    return wifi->state == WIFI_STATE_UP;
+}
+
+uint64_t wifi_supervisor_next_event_us(const wifi_supervisor_t *wifi)
+{
+    return wifi->state == WIFI_STATE_UP ? UINT64_MAX : wifi->next_us;
+}
@@ -5,12 +5,101 @@
 #define WIFI_PASSWORD "batatinha"
 #define WIFI_TIMEOUT_MS 10000
 
+#include <stdbool.h>
+#include <stdint.h>
+
 #include "pico/cyw43_arch.h"
 
+/// Primeira espera após uma tentativa de conexão frustrada (dobra a cada falha seguida)
+#define WIFI_BACKOFF_MIN_MS 1000
+
+/// Maior espera entre tentativas de conexão
+#define WIFI_BACKOFF_MAX_MS 30000
+
+/// Intervalo de verificação enquanto uma varredura ou associação está em andamento
+#define WIFI_POLL_INTERVAL_MS 100
+
+/**
+ * @brief Estado do supervisor da conexão Wi-Fi.
+ */
+typedef enum
+{
+    WIFI_STATE_DOWN,     ///< Sem conexão, aguardando a próxima tentativa
+    WIFI_STATE_SCANNING, ///< Procurando o ponto de acesso (sem BSSID em cache)
+    WIFI_STATE_JOINING,  ///< Associando e obtendo IP
+    WIFI_STATE_UP,       ///< Conectado, com IP
+} wifi_state_t;
+
+/**
+ * @brief Supervisor da conexão em modo estação: reconecta sozinho e mede as quedas.
+ *
+ * O BSSID e o canal do ponto de acesso ficam em cache: a reconexão vai direto
+ * a eles, sem varrer todos os canais. Se a reconexão pelo cache falhar, o
+ * cache é descartado e a próxima tentativa faz uma varredura nova.
+ */
+typedef struct
+{
+    wifi_state_t state;          ///< Estado atual
+    uint8_t bssid[6];            ///< BSSID do ponto de acesso em cache
+    uint16_t channel;            ///< Canal do ponto de acesso em cache
+    bool cached;                 ///< BSSID e canal válidos
+    bool fast_join;              ///< A tentativa atual usa o cache
+    bool scan_found;             ///< A varredura atual encontrou a rede
+    bool link_lost;              ///< O callback de enlace sinalizou uma queda
+    int16_t scan_rssi;           ///< Sinal do melhor ponto de acesso da varredura atual
+    uint8_t failures_in_row;     ///< Tentativas frustradas seguidas (definem a espera)
+    uint64_t attempt_us;         ///< Início da tentativa atual
+    uint64_t next_us;            ///< Próxima tentativa (DOWN) ou verificação (SCANNING/JOINING)
+    uint64_t down_us;            ///< Início da queda atual (ou do boot, antes da primeira conexão)
+    uint32_t disconnects;        ///< Quedas da conexão
+    uint32_t attempts;           ///< Tentativas de associação
+    uint32_t fast_joins;         ///< Conexões obtidas pelo cache (sem varredura)
+    uint32_t failures;           ///< Tentativas frustradas
+    uint32_t last_reconnect_ms;  ///< Duração da última tentativa bem-sucedida
+    uint32_t max_reconnect_ms;   ///< Maior duração de uma tentativa bem-sucedida
+    uint32_t last_downtime_ms;   ///< Duração da última queda (da perda do enlace até ter IP de novo)
+    uint64_t total_downtime_ms;  ///< Soma das quedas
+} wifi_supervisor_t;
+
 void init_wifi_sta();
 
 void init_wifi_ap();
 
 void connect_to_wifi();
 
+/**
+ * @brief Inicia o supervisor e a primeira conexão, sem bloquear.
+ *
+ * Deve ser chamada após init_wifi_sta(). Registra o callback de enlace do lwIP
+ * na interface de estação para perceber as quedas assim que ocorrem.
+ *
+ * @param wifi Supervisor (apenas um por firmware).
+ */
+void wifi_supervisor_init(wifi_supervisor_t *wifi);
+
+/**
+ * @brief Avança a máquina de estados: detecta quedas e conduz as tentativas.
+ * @param wifi Supervisor.
+ * @param now_us Instante atual (time_us_64()).
+ */
+void wifi_supervisor_poll(wifi_supervisor_t *wifi, uint64_t now_us);
+
+/**
+ * @brief Indica se há conexão com IP.
+ * @param wifi Supervisor.
+ */
+bool wifi_supervisor_online(const wifi_supervisor_t *wifi);
+
+/**
+ * @brief Instante em que wifi_supervisor_poll() tem algo a fazer.
+ * @param wifi Supervisor.
+ * @return Instante absoluto em microssegundos, ou UINT64_MAX se conectado.
+ */
+uint64_t wifi_supervisor_next_event_us(const wifi_supervisor_t *wifi);
+
+/**
+ * @brief Nome curto de um estado, para logs.
+ */
+const char *wifi_state_name(wifi_state_t state);
+
 #endif
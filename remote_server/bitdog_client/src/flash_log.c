@@ -0,0 +1,304 @@
+#include "flash_log.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "pico/flash.h"
+
+#include "drivers/storage.h"
+
+/** @brief Identifies a log page (changes whenever BATCH_ENTRY_T changes layout). */
+#define FLASH_LOG_MAGIC 0x32474C57u // "WLG2"
+/** @brief Value of an erased flash word. */
+#define FLASH_LOG_ERASED 0xFFFFFFFFu
+/** @brief Pages per erasable sector. */
+#define FLASH_LOG_PAGES_PER_SECTOR (FLASH_SECTOR_SIZE / FLASH_PAGE_SIZE)
+/** @brief Offset of the first log page from the start of flash. */
+#define FLASH_LOG_OFFSET (PICO_FLASH_SIZE_BYTES - STORAGE_RESERVED_BYTES - FLASH_LOG_SECTORS * FLASH_SECTOR_SIZE)
+/** @brief Maximum wait for exclusive flash access. */
+#define FLASH_LOG_FLASH_TIMEOUT_MS 100
+
+/**
+ * @brief Header at the start of each log page.
+ */
+typedef struct
+{
+    uint32_t magic;    ///< FLASH_LOG_MAGIC.
+    uint32_t sequence; ///< Increases by one per page written.
+    uint8_t count;     ///< Readings in the page.
+    uint8_t reserved;  ///< Left erased.
+    uint16_t crc;      ///< CRC-16 of the readings.
+    uint32_t sent;     ///< FLASH_LOG_ERASED until the page is posted, then 0.
+} FLASH_LOG_PAGE_HEADER_T;
+
+static_assert(sizeof(FLASH_LOG_PAGE_HEADER_T) == FLASH_LOG_PAGE_HEADER_SIZE, "log page header size");
+static_assert(FLASH_LOG_PAGE_ENTRIES <= UINT8_MAX, "page entry count must fit the header");
+
+/**
+ * @brief Flash operation run with the flash locked.
+ */
+typedef struct
+{
+    uint32_t offset;     ///< Offset from the start of flash.
+    bool erase;          ///< Erase the sector at `offset` instead of programming.
+    const uint8_t *page; ///< Page to program.
+} FLASH_LOG_OP_T;
+
+/** @brief Page being programmed (the only RAM buffer of the log). */
+static uint8_t page_buffer[FLASH_PAGE_SIZE];
+
+static uint32_t flash_log_page_offset(uint16_t page)
+{
+    return FLASH_LOG_OFFSET + (uint32_t)page * FLASH_PAGE_SIZE;
+}
+
+static const FLASH_LOG_PAGE_HEADER_T *flash_log_header(uint16_t page)
+{
+    return (const FLASH_LOG_PAGE_HEADER_T *)(XIP_BASE + flash_log_page_offset(page));
+}
+
+static const BATCH_ENTRY_T *flash_log_entries(uint16_t page)
+{
+    return (const BATCH_ENTRY_T *)((const uint8_t *)flash_log_header(page) + FLASH_LOG_PAGE_HEADER_SIZE);
+}
+
+static uint16_t flash_log_next(uint16_t page)
+{
+    return (uint16_t)((page + 1) % FLASH_LOG_PAGES);
+}
+
+/**
+ * @brief Checks magic, count and CRC (torn or foreign pages are ignored).
+ */
+static bool flash_log_valid(uint16_t page)
+{
+    const FLASH_LOG_PAGE_HEADER_T *header = flash_log_header(page);
+    if (header->magic != FLASH_LOG_MAGIC || header->count == 0 || header->count > FLASH_LOG_PAGE_ENTRIES)
+        return false;
+    return storage_crc16(flash_log_entries(page), header->count * sizeof(BATCH_ENTRY_T)) == header->crc;
+}
+
+static bool flash_log_unsent(uint16_t page)
+{
+    return flash_log_valid(page) && flash_log_header(page)->sent == FLASH_LOG_ERASED;
+}
+
+/**
+ * @brief Checks whether `words` flash words starting at `page` are all erased.
+ */
+static bool flash_log_blank(uint16_t page, uint32_t words)
+{
+    const uint32_t *data = (const uint32_t *)flash_log_header(page);
+    for (uint32_t i = 0; i < words; ++i)
+        if (data[i] != FLASH_LOG_ERASED)
+            return false;
+    return true;
+}
+
+static void flash_log_locked(void *param)
+{
+    const FLASH_LOG_OP_T *op = (const FLASH_LOG_OP_T *)param;
+    if (op->erase)
+        flash_range_erase(op->offset, FLASH_SECTOR_SIZE);
+    else
+        flash_range_program(op->offset, op->page, FLASH_PAGE_SIZE);
+}
+
+static bool flash_log_flash(uint16_t page, bool erase)
+{
+    FLASH_LOG_OP_T op = {
+        .offset = flash_log_page_offset(page),
+        .erase = erase,
+        .page = page_buffer,
+    };
+
+    int err = flash_safe_execute(flash_log_locked, &op, FLASH_LOG_FLASH_TIMEOUT_MS);
+    if (err != PICO_OK)
+    {
+        printf("Falha ao gravar o log na flash: %d\n", err);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Moves the head to a blank page, erasing the next sector when the head enters it.
+ */
+static bool flash_log_prepare_head(FLASH_LOG_T *log)
+{
+    for (uint16_t tries = 0; tries < FLASH_LOG_PAGES; ++tries)
+    {
+        if (log->head % FLASH_LOG_PAGES_PER_SECTOR == 0 &&
+            !flash_log_blank(log->head, FLASH_SECTOR_SIZE / sizeof(uint32_t)))
+        {
+            // Wrapped into the oldest sector: whatever is still unsent there is lost
+            bool tail_inside = false;
+            for (uint16_t i = 0; i < FLASH_LOG_PAGES_PER_SECTOR; ++i)
+            {
+                uint16_t page = log->head + i;
+                if (!flash_log_unsent(page))
+                    continue;
+                log->dropped += flash_log_header(page)->count;
+                log->pending--;
+                tail_inside |= page == log->tail;
+            }
+            if (tail_inside) // The cursor is never behind the tail, so it was in this sector too
+                log->tail = log->cursor = (uint16_t)((log->head + FLASH_LOG_PAGES_PER_SECTOR) % FLASH_LOG_PAGES);
+
+            if (!flash_log_flash(log->head, true))
+                return false;
+        }
+
+        if (flash_log_blank(log->head, FLASH_PAGE_SIZE / sizeof(uint32_t)))
+            return true;
+        log->head = flash_log_next(log->head); // Torn page from a power loss: skip it
+    }
+    return false;
+}
+
+void flash_log_init(FLASH_LOG_T *log)
+{
+    bool found = false;
+    bool found_unsent = false;
+    uint32_t newest = 0;
+    uint32_t oldest_unsent = 0;
+    uint16_t newest_page = 0;
+
+    memset(log, 0, sizeof(*log));
+
+    for (uint16_t page = 0; page < FLASH_LOG_PAGES; ++page)
+    {
+        if (!flash_log_valid(page))
+            continue;
+
+        uint32_t sequence = flash_log_header(page)->sequence;
+        if (!found || sequence > newest)
+        {
+            newest = sequence;
+            newest_page = page;
+            found = true;
+        }
+        if (flash_log_header(page)->sent == FLASH_LOG_ERASED)
+        {
+            if (!found_unsent || sequence < oldest_unsent)
+            {
+                oldest_unsent = sequence;
+                log->tail = page;
+                found_unsent = true;
+            }
+            log->pending++;
+        }
+    }
+
+    log->head = found ? flash_log_next(newest_page) : 0;
+    log->sequence = found ? newest + 1 : 0;
+    if (!found_unsent)
+        log->tail = log->head;
+    log->cursor = log->tail; // Whatever was in flight before the reboot goes out again
+
+    if (log->pending)
+        printf("Log na flash: %u páginas a reenviar\n", log->pending);
+}
+
+bool flash_log_append(FLASH_LOG_T *log, const BATCH_ENTRY_T *entries, uint8_t count)
+{
+    while (count > 0)
+    {
+        uint8_t n = count < FLASH_LOG_PAGE_ENTRIES ? count : FLASH_LOG_PAGE_ENTRIES;
+
+        if (!flash_log_prepare_head(log))
+            return false;
+
+        FLASH_LOG_PAGE_HEADER_T header = {
+            .magic = FLASH_LOG_MAGIC,
+            .sequence = log->sequence,
+            .count = n,
+            .reserved = 0xFF,
+            .crc = storage_crc16(entries, n * sizeof(BATCH_ENTRY_T)),
+            .sent = FLASH_LOG_ERASED,
+        };
+        memset(page_buffer, 0xFF, sizeof(page_buffer));
+        memcpy(page_buffer, &header, sizeof(header));
+        memcpy(page_buffer + FLASH_LOG_PAGE_HEADER_SIZE, entries, n * sizeof(BATCH_ENTRY_T));
+
+        if (!flash_log_flash(log->head, false))
+            return false;
+
+        if (log->pending == 0)
+            log->tail = log->cursor = log->head;
+        log->pending++;
+        log->sequence++;
+        log->written += n;
+        log->head = flash_log_next(log->head);
+        entries += n;
+        count -= n;
+    }
+    return true;
+}
+
+const BATCH_ENTRY_T *flash_log_replay(FLASH_LOG_T *log, uint8_t *count, uint32_t *sequence)
+{
+    if (log->pending == 0)
+        return NULL;
+
+    // Sent and torn pages are skipped
+    while (log->cursor != log->head && !flash_log_unsent(log->cursor))
+        log->cursor = flash_log_next(log->cursor);
+    if (log->cursor == log->head)
+    {
+        if (log->tail == log->head)
+            log->pending = 0; // Counter out of step with flash (should not happen)
+        return NULL;
+    }
+
+    uint16_t page = log->cursor;
+    log->cursor = flash_log_next(page);
+    *count = flash_log_header(page)->count;
+    *sequence = flash_log_header(page)->sequence;
+    return flash_log_entries(page);
+}
+
+bool flash_log_consume(FLASH_LOG_T *log, uint32_t sequence)
+{
+    uint16_t page = log->tail;
+    while (page != log->cursor && !(flash_log_unsent(page) && flash_log_header(page)->sequence == sequence))
+        page = flash_log_next(page);
+    if (page == log->cursor)
+        return false;
+
+    // Only the `sent` word goes from erased to 0; the 0xFF bytes leave the rest of the page as is
+    memset(page_buffer, 0xFF, sizeof(page_buffer));
+    memset(page_buffer + offsetof(FLASH_LOG_PAGE_HEADER_T, sent), 0, sizeof(uint32_t));
+    uint8_t count = flash_log_header(page)->count;
+    if (!flash_log_flash(page, false))
+        return false;
+
+    log->pending--;
+    log->drained += count;
+    while (log->tail != log->cursor && !flash_log_unsent(log->tail))
+        log->tail = flash_log_next(log->tail);
+    return true;
+}
+
+void flash_log_rewind(FLASH_LOG_T *log)
+{
+    log->cursor = log->tail;
+}
+
+bool flash_log_waiting(const FLASH_LOG_T *log)
+{
+    if (log->pending == 0)
+        return false;
+
+    for (uint16_t page = log->cursor; page != log->head; page = flash_log_next(page))
+        if (flash_log_unsent(page))
+            return true; // Usually the first one: pages past the cursor are only sent if torn
+    return false;
+}
+
+bool flash_log_empty(const FLASH_LOG_T *log)
+{
+    return log->pending == 0;
+}
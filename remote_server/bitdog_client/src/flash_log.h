@@ -0,0 +1,112 @@
+/**
+ * @file flash_log.h
+ * @brief Store-and-forward log of unsent readings in flash.
+ *
+ * Batches that cannot be posted (Wi-Fi down, server unreachable) are written
+ * to a circular log in the FLASH_LOG_SECTORS sectors right below the storage
+ * slots, so they survive reboots. Each flash page holds one header and up to
+ * FLASH_LOG_PAGE_ENTRIES readings. Pages are written in order around the ring
+ * and a sector is only erased when the writer wraps back into it, so every
+ * sector wears at the same rate. Pages are handed out for replay in order
+ * and stay unsent while their requests are in flight; only once the server
+ * answered is a page's header marked sent in place (bits are only cleared, no
+ * erase), so a reboot or a lost request replays it again. When the ring is
+ * full the oldest unsent pages are overwritten and counted in `dropped`.
+ *
+ * RAM use is fixed: the state below plus one page buffer. Pages are read
+ * straight from the XIP mapping.
+ */
+
+#ifndef FLASH_LOG_H
+#define FLASH_LOG_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "hardware/flash.h"
+
+#include "batch.h"
+
+/** @brief Sectors reserved for the log (right below the storage slots). */
+#define FLASH_LOG_SECTORS 32
+/** @brief Pages in the log. */
+#define FLASH_LOG_PAGES (FLASH_LOG_SECTORS * FLASH_SECTOR_SIZE / FLASH_PAGE_SIZE)
+/** @brief Bytes of each page before the readings. */
+#define FLASH_LOG_PAGE_HEADER_SIZE 16
+/** @brief Readings per flash page. */
+#define FLASH_LOG_PAGE_ENTRIES ((FLASH_PAGE_SIZE - FLASH_LOG_PAGE_HEADER_SIZE) / sizeof(BATCH_ENTRY_T))
+/** @brief Minimum spacing between two pages replayed from the log. */
+#define FLASH_LOG_DRAIN_INTERVAL_MS 250
+
+/**
+ * @brief Log position and counters (rebuilt from flash by `flash_log_init`).
+ */
+typedef struct
+{
+    uint16_t head;      ///< Next page to write.
+    uint16_t tail;      ///< Oldest page that may still be unsent.
+    uint16_t cursor;    ///< Next page to hand out for replay (the unsent ones before it are in flight).
+    uint16_t pending;   ///< Pages written and not sent yet.
+    uint32_t sequence;  ///< Sequence number of the next page written.
+    uint32_t written;   ///< Readings written to the log since boot.
+    uint32_t drained;   ///< Readings replayed from the log since boot.
+    uint32_t dropped;   ///< Unsent readings overwritten because the log was full.
+} FLASH_LOG_T;
+
+/**
+ * @brief Finds the head and tail by scanning the log pages.
+ * @param log Log state to rebuild.
+ */
+void flash_log_init(FLASH_LOG_T *log);
+
+/**
+ * @brief Writes readings to the log, one page per FLASH_LOG_PAGE_ENTRIES readings.
+ *
+ * Programming (and erasing, when the writer enters a new sector) blocks
+ * interrupts for a few milliseconds per page.
+ *
+ * @param log Log state.
+ * @param entries Readings, oldest first.
+ * @param count Number of readings.
+ * @return false if flash access failed.
+ */
+bool flash_log_append(FLASH_LOG_T *log, const BATCH_ENTRY_T *entries, uint8_t count);
+
+/**
+ * @brief Hands out the oldest unsent page that is not in flight yet.
+ * @param log Log state.
+ * @param count Receives the number of readings in the page.
+ * @param sequence Receives the page sequence number (for `flash_log_consume`).
+ * @return Readings in flash (valid until the next append), or NULL if no page is waiting.
+ */
+const BATCH_ENTRY_T *flash_log_replay(FLASH_LOG_T *log, uint8_t *count, uint32_t *sequence);
+
+/**
+ * @brief Marks a page handed out by `flash_log_replay` as sent, once the server took it.
+ * @param log Log state.
+ * @param sequence Sequence number of the page (answers may come in any order).
+ * @return false if the page is no longer in the log (overwritten) or flash access failed.
+ */
+bool flash_log_consume(FLASH_LOG_T *log, uint32_t sequence);
+
+/**
+ * @brief Hands out again every unsent page, for when nothing is in flight any more.
+ * @param log Log state.
+ */
+void flash_log_rewind(FLASH_LOG_T *log);
+
+/**
+ * @brief Checks whether a page is waiting for `flash_log_replay`.
+ * @param log Log state.
+ * @return true if an unsent page was not handed out yet.
+ */
+bool flash_log_waiting(const FLASH_LOG_T *log);
+
+/**
+ * @brief Checks whether there are unsent readings.
+ * @param log Log state.
+ * @return true if no page is pending.
+ */
+bool flash_log_empty(const FLASH_LOG_T *log);
+
+#endif
@@ -0,0 +1,471 @@
+#include "http_link.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "pico/stdlib.h"
+
+#include "lwip/tcp.h"
+#include "lwip/pbuf.h"
+
+static HTTP_LINK_SLOT_T *http_link_slot(HTTP_LINK_T *link, uint8_t index)
+{
+    return &link->slots[(link->first + index) % HTTP_LINK_WINDOW];
+}
+
+/**
+ * @brief Removes a request from the window; the ones after it move up a slot, so the ring stays in write order.
+ */
+static void http_link_retire(HTTP_LINK_T *link, uint8_t index)
+{
+    if (index == 0)
+        link->first = (link->first + 1) % HTTP_LINK_WINDOW;
+    else // Only behind a request that stays (retryable response, tagged request): rare, and at most a few slots
+        for (uint8_t i = index; i + 1 < link->used; ++i)
+            *http_link_slot(link, i) = *http_link_slot(link, i + 1);
+    link->used--;
+}
+
+/**
+ * @brief Sets the connected state from the window occupancy.
+ */
+static void http_link_update_state(HTTP_LINK_T *link)
+{
+    if (link->state == HTTP_LINK_SENDING || link->state == HTTP_LINK_AWAITING_RESPONSE)
+        link->state = link->used == HTTP_LINK_WINDOW ? HTTP_LINK_AWAITING_RESPONSE : HTTP_LINK_SENDING;
+}
+
+/**
+ * @brief Forgets the PCB (already freed or closed); unanswered requests will be written again.
+ * @param failure Whether to back off before reconnecting (errors and timeouts, not server closes).
+ */
+static void http_link_disconnected(HTTP_LINK_T *link, bool failure)
+{
+    link->pcb = NULL;
+    link->pcb_requests = 0;
+    for (uint8_t i = 0; i < link->used; ++i)
+        http_link_slot(link, i)->written = false;
+
+    if (!failure)
+    {
+        link->state = HTTP_LINK_IDLE;
+        return;
+    }
+
+    uint8_t shift = link->failures_in_row < 16 ? link->failures_in_row : 16;
+    uint32_t backoff_ms = (uint32_t)HTTP_LINK_BACKOFF_MIN_MS << shift;
+    if (backoff_ms > HTTP_LINK_BACKOFF_MAX_MS)
+        backoff_ms = HTTP_LINK_BACKOFF_MAX_MS;
+    link->failures_in_row++;
+    link->state = HTTP_LINK_BACKOFF;
+    link->deadline_us = time_us_64() + (uint64_t)backoff_ms * 1000;
+}
+
+/**
+ * @brief Aborts the connection after a timeout and backs off.
+ */
+static void http_link_timeout(HTTP_LINK_T *link)
+{
+    printf("Tempo esgotado na conexão HTTP (%s)\n", http_link_state_name(link->state));
+    link->timeouts++;
+    if (link->pcb)
+    {
+        tcp_arg(link->pcb, NULL); // tcp_abort calls the error callback
+        tcp_abort(link->pcb);
+    }
+    http_link_disconnected(link, true);
+}
+
+/**
+ * @brief Writes every request in the window that is not on the current connection yet.
+ */
+static void http_link_write_slots(HTTP_LINK_T *link)
+{
+    if (link->state != HTTP_LINK_SENDING && link->state != HTTP_LINK_AWAITING_RESPONSE)
+        return;
+
+    // Untagged requests that already failed too many times are given up; tagged ones wait for an answer
+    for (uint8_t i = 0; i < link->used;)
+    {
+        HTTP_LINK_SLOT_T *slot = http_link_slot(link, i);
+        if (slot->written || slot->attempts < HTTP_LINK_MAX_ATTEMPTS || slot->tag != HTTP_LINK_NO_TAG)
+        {
+            ++i;
+            continue;
+        }
+        http_link_retire(link, i);
+        link->lost++;
+    }
+
+    bool wrote = false;
+    for (uint8_t i = 0; i < link->used; ++i)
+    {
+        HTTP_LINK_SLOT_T *slot = http_link_slot(link, i);
+        if (slot->written)
+            continue;
+        if (tcp_sndbuf(link->pcb) < slot->len ||
+            tcp_write(link->pcb, slot->data, slot->len, TCP_WRITE_FLAG_COPY) != ERR_OK)
+            break; // The sent callback resumes once lwIP frees buffer space
+
+        if (slot->attempts > 0)
+            link->retries++;
+        if (link->pcb_requests > 0)
+            link->reused++;
+        if (slot->attempts < UINT8_MAX)
+            slot->attempts++;
+        slot->written = true;
+        slot->written_us = time_us_64();
+        link->pcb_requests++;
+        link->requests++;
+        wrote = true;
+    }
+
+    if (wrote)
+        tcp_output(link->pcb);
+    http_link_update_state(link);
+}
+
+/**
+ * @brief Applies a complete response to the request it answers.
+ * @param index Slot of that request (responses come in write order).
+ * @return false if the request must be written again (it stays in its slot; the caller resets the connection).
+ */
+static bool http_link_answered(HTTP_LINK_T *link, uint8_t index)
+{
+    uint16_t status = link->response.status;
+    HTTP_LINK_SLOT_T *slot = http_link_slot(link, index);
+    link->last_status = status;
+
+    if (index >= link->used || !slot->written)
+        return true; // Unsolicited response
+
+    if (status >= 500 || status == 408 || status == 429)
+    {
+        printf("Servidor pediu nova tentativa: %u\n", status);
+        link->server_errors++;
+        return false;
+    }
+
+    if (status >= 200 && status < 300)
+    {
+        link->responses++;
+        link->failures_in_row = 0;
+        if (slot->attempts == 1)
+        { // A retried request's round trip includes the outage: no use for the clock
+            link->clock_sent_us = slot->stamp_us;
+            link->clock_answered_us = time_us_64();
+        }
+    }
+    else
+    {
+        printf("Requisição rejeitada pelo servidor: %u\n", status);
+        link->rejected++;
+    }
+
+    // Final either way: a refused request would be refused again
+    if (slot->tag != HTTP_LINK_NO_TAG && link->answered_count < HTTP_LINK_WINDOW)
+        link->answered[link->answered_count++] = slot->tag;
+
+    http_link_retire(link, index);
+    http_link_update_state(link);
+    return true;
+}
+
+static err_t http_link_sent(void *arg, struct tcp_pcb *tpcb, u16_t len)
+{
+    http_link_write_slots((HTTP_LINK_T *)arg); // Acknowledged data freed send buffer space
+    return ERR_OK;
+}
+
+static err_t http_link_recv(void *arg, struct tcp_pcb *tpcb, struct pbuf *p, err_t err)
+{
+    HTTP_LINK_T *link = (HTTP_LINK_T *)arg;
+
+    if (!p)
+    { // The server closed the connection: reconnect (without backoff) if requests are outstanding
+        link->drops++;
+        http_link_disconnected(link, false);
+        tcp_arg(tpcb, NULL);
+        if (tcp_close(tpcb) != ERR_OK)
+        {
+            tcp_abort(tpcb);
+            return ERR_ABRT;
+        }
+        return ERR_OK;
+    }
+
+    // Pipelined responses arrive back to back, split anywhere: parse them in place, segment by segment.
+    // A retryable status does not stop the parsing: the requests answered behind it must not be written again
+    uint8_t next = 0; // Slot answered by the next response (requests to retry stay in theirs)
+    bool retry = false;
+    bool broken = false;
+    bool close = false;
+    for (struct pbuf *q = p; q && !broken && !close; q = q->next)
+    {
+        const char *data = (const char *)q->payload;
+        size_t left = q->len;
+        while (left > 0)
+        {
+            size_t used = http_response_feed(&link->response, data, left);
+            data += used;
+            left -= used;
+
+            if (link->response.state == HTTP_RESPONSE_ERROR)
+            {
+                printf("Resposta HTTP malformada\n");
+                link->parse_errors++;
+                retry = true;
+                broken = true; // Framing is lost: the rest of the stream cannot be matched to requests
+                break;
+            }
+            if (link->response.state != HTTP_RESPONSE_DONE)
+                continue;
+            if (!http_link_answered(link, next))
+            {
+                retry = true;
+                next++;
+            }
+            if (link->response.close)
+            {
+                close = true;
+                break;
+            }
+        }
+    }
+
+    tcp_recved(tpcb, p->tot_len);
+    pbuf_free(p);
+
+    if (retry)
+    { // The failed and the unanswered requests go out again, in order, on a new connection after the backoff
+        tcp_arg(tpcb, NULL);
+        tcp_abort(tpcb);
+        http_link_disconnected(link, true);
+        return ERR_ABRT;
+    }
+    if (close)
+    { // The server will not answer anything else on this connection
+        link->drops++;
+        http_link_disconnected(link, false);
+        tcp_arg(tpcb, NULL);
+        if (tcp_close(tpcb) != ERR_OK)
+        {
+            tcp_abort(tpcb);
+            return ERR_ABRT;
+        }
+        return ERR_OK;
+    }
+
+    http_link_write_slots(link); // Answered requests made room in the window
+    return ERR_OK;
+}
+
+static void http_link_err(void *arg, err_t err)
+{
+    HTTP_LINK_T *link = (HTTP_LINK_T *)arg;
+    if (!link)
+        return;
+
+    printf("Conexão HTTP perdida: %d\n", err);
+    link->failures++;
+    http_link_disconnected(link, true); // lwIP already freed the PCB
+}
+
+static err_t http_link_connected(void *arg, struct tcp_pcb *tpcb, err_t err)
+{
+    HTTP_LINK_T *link = (HTTP_LINK_T *)arg;
+
+    if (err != ERR_OK)
+    {
+        printf("Erro na conexão: %d\n", err);
+        link->failures++;
+        http_link_disconnected(link, true);
+        tcp_arg(tpcb, NULL);
+        tcp_abort(tpcb);
+        return ERR_ABRT;
+    }
+
+    link->state = HTTP_LINK_SENDING;
+    link->connects++;
+    http_response_reset(&link->response);
+    http_link_write_slots(link);
+    return ERR_OK;
+}
+
+/**
+ * @brief Starts the handshake; requests wait in their slots until it completes.
+ */
+static void http_link_connect(HTTP_LINK_T *link)
+{
+    struct tcp_pcb *pcb = tcp_new_ip_type(IP_GET_TYPE(&link->server_ip));
+    if (!pcb)
+    {
+        printf("Erro ao criar PCB TCP\n");
+        link->failures++;
+        http_link_disconnected(link, true);
+        return;
+    }
+
+    tcp_arg(pcb, link);
+    tcp_recv(pcb, http_link_recv);
+    tcp_sent(pcb, http_link_sent);
+    tcp_err(pcb, http_link_err);
+    tcp_nagle_disable(pcb); // Pipelined POSTs must not wait for the previous ACK
+
+    // Notice a server that vanished without closing (the heartbeat alone would not)
+    ip_set_option(pcb, SOF_KEEPALIVE);
+    pcb->keep_idle = HTTP_LINK_KEEPALIVE_IDLE_MS;
+    pcb->keep_intvl = HTTP_LINK_KEEPALIVE_INTERVAL_MS;
+    pcb->keep_cnt = HTTP_LINK_KEEPALIVE_COUNT;
+
+    link->pcb = pcb;
+    link->state = HTTP_LINK_CONNECTING;
+    link->deadline_us = time_us_64() + HTTP_LINK_CONNECT_TIMEOUT_MS * 1000ull;
+
+    err_t err = tcp_connect(pcb, &link->server_ip, link->server_port, http_link_connected);
+    if (err != ERR_OK)
+    {
+        printf("Erro ao conectar: %d\n", err);
+        link->failures++;
+        tcp_arg(pcb, NULL);
+        tcp_abort(pcb);
+        http_link_disconnected(link, true);
+    }
+}
+
+void http_link_init(HTTP_LINK_T *link)
+{
+    memset(link, 0, sizeof(*link));
+    link->state = HTTP_LINK_IDLE;
+}
+
+void http_link_set_server(HTTP_LINK_T *link, const ip_addr_t *server_ip, uint16_t server_port)
+{
+    if (link->has_server && ip_addr_cmp(&link->server_ip, server_ip) && link->server_port == server_port)
+        return;
+
+    ip_addr_copy(link->server_ip, *server_ip);
+    link->server_port = server_port;
+    link->has_server = true;
+    link->failures_in_row = 0;
+
+    if (link->pcb)
+    {
+        tcp_arg(link->pcb, NULL);
+        tcp_abort(link->pcb);
+    }
+    if (link->pcb || link->state == HTTP_LINK_BACKOFF)
+        http_link_disconnected(link, false); // http_link_poll reconnects to the new server
+}
+
+bool http_link_ready(const HTTP_LINK_T *link)
+{
+    return link->has_server && link->state != HTTP_LINK_BACKOFF && link->used < HTTP_LINK_WINDOW;
+}
+
+bool http_link_send(HTTP_LINK_T *link, const char *request, uint16_t len, uint64_t stamp_us, uint32_t tag)
+{
+    if (len > HTTP_LINK_REQUEST_MAX || !http_link_ready(link))
+        return false;
+
+    HTTP_LINK_SLOT_T *slot = http_link_slot(link, link->used++);
+    memcpy(slot->data, request, len);
+    slot->len = len;
+    slot->stamp_us = stamp_us;
+    slot->tag = tag;
+    slot->attempts = 0;
+    slot->written = false;
+
+    if (link->state == HTTP_LINK_IDLE)
+        http_link_connect(link);
+    else
+        http_link_write_slots(link);
+    return true;
+}
+
+bool http_link_take_answered(HTTP_LINK_T *link, uint32_t *tag)
+{
+    if (link->answered_count == 0)
+        return false;
+
+    *tag = link->answered[0];
+    link->answered_count--;
+    memmove(link->answered, link->answered + 1, link->answered_count * sizeof(link->answered[0]));
+    return true;
+}
+
+uint8_t http_link_tagged(const HTTP_LINK_T *link)
+{
+    uint8_t tagged = 0;
+    for (uint8_t i = 0; i < link->used; ++i)
+        if (link->slots[(link->first + i) % HTTP_LINK_WINDOW].tag != HTTP_LINK_NO_TAG)
+            tagged++;
+    return tagged;
+}
+
+void http_link_poll(HTTP_LINK_T *link, uint64_t now_us)
+{
+    switch (link->state)
+    {
+    case HTTP_LINK_IDLE:
+        if (link->used > 0) // Closed by the server with requests still unanswered
+            http_link_connect(link);
+        break;
+    case HTTP_LINK_CONNECTING:
+        if (now_us >= link->deadline_us)
+            http_link_timeout(link);
+        break;
+    case HTTP_LINK_SENDING:
+    case HTTP_LINK_AWAITING_RESPONSE:
+        if (link->used > 0 && http_link_slot(link, 0)->written &&
+            now_us - http_link_slot(link, 0)->written_us >= HTTP_LINK_RESPONSE_TIMEOUT_MS * 1000ull)
+            http_link_timeout(link);
+        break;
+    case HTTP_LINK_BACKOFF:
+        if (now_us >= link->deadline_us)
+        {
+            link->state = HTTP_LINK_IDLE;
+            if (link->used > 0)
+                http_link_connect(link);
+        }
+        break;
+    }
+}
+
+uint64_t http_link_next_event_us(const HTTP_LINK_T *link)
+{
+    const HTTP_LINK_SLOT_T *oldest = &link->slots[link->first];
+
+    switch (link->state)
+    {
+    case HTTP_LINK_IDLE:
+        return link->used > 0 ? 0 : UINT64_MAX;
+    case HTTP_LINK_CONNECTING:
+    case HTTP_LINK_BACKOFF:
+        return link->deadline_us;
+    case HTTP_LINK_SENDING:
+    case HTTP_LINK_AWAITING_RESPONSE:
+        if (link->used > 0 && oldest->written)
+            return oldest->written_us + HTTP_LINK_RESPONSE_TIMEOUT_MS * 1000ull;
+        break;
+    }
+    return UINT64_MAX;
+}
+
+const char *http_link_state_name(HTTP_LINK_STATE_T state)
+{
+    switch (state)
+    {
+    case HTTP_LINK_IDLE:
+        return "ociosa";
+    case HTTP_LINK_CONNECTING:
+        return "conectando";
+    case HTTP_LINK_SENDING:
+        return "enviando";
+    case HTTP_LINK_AWAITING_RESPONSE:
+        return "aguardando";
+    case HTTP_LINK_BACKOFF:
+        return "espera";
+    }
+    return "?";
+}
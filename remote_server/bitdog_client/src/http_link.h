@@ -0,0 +1,216 @@
+/**
+ * @file http_link.h
+ * @brief Persistent (keep-alive) HTTP connection to the readings server.
+ *
+ * One TCP connection is kept open to the server and requests are written on
+ * it back to back, without waiting for the previous response (pipelining).
+ * At most HTTP_LINK_WINDOW requests are outstanding; each one is a private
+ * copy held in a window slot until its response arrives. If the connection is
+ * closed by the server (empty `recv`), fails (`tcp_err`) or times out, the
+ * unanswered requests are written again on the next connection, up to
+ * HTTP_LINK_MAX_ATTEMPTS times each. Failures and timeouts back off
+ * exponentially before reconnecting.
+ *
+ * Responses are parsed as they stream in (`http_response.h`): a 2xx answers
+ * the oldest request; a 4xx rejects it for good (sending it again would not
+ * help); a 5xx, 408 or 429 is treated like a failed connection, so the
+ * request is written again after the backoff. The responses already received
+ * behind a retryable one are still applied, so only the failed request and
+ * the unanswered ones are written again.
+ *
+ * A request may carry a caller tag. A tagged request is never given up: it
+ * is written again, connection after connection, until the server gives a
+ * final answer (2xx or 4xx), and then its tag is queued for
+ * `http_link_take_answered`. This is how the flash log learns which replayed
+ * pages the server took.
+ *
+ * Each request carries a caller stamp (its send time in the body). When a
+ * request written only once is answered with a 2xx, the stamp and the time
+ * the response completed are kept as a clock sample: sent with the next
+ * request, they let the server work out the clock offset NTP-style from its
+ * own receive and reply times for the stamped request.
+ *
+ * `http_link_poll` must be called from the main loop; it enforces the
+ * timeouts and ends the backoff. No request is taken until
+ * `http_link_set_server` gives the server address.
+ */
+
+#ifndef HTTP_LINK_H
+#define HTTP_LINK_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "lwip/ip_addr.h"
+
+#include "http_response.h"
+
+/** @brief Largest request accepted (headers and body). */
+#define HTTP_LINK_REQUEST_MAX 3072
+/** @brief Requests that may be outstanding (written or waiting) at once. */
+#define HTTP_LINK_WINDOW 4
+/** @brief Times an untagged request is written before it is given up. */
+#define HTTP_LINK_MAX_ATTEMPTS 3
+/** @brief Tag of a request that is not reported back (and may be given up). */
+#define HTTP_LINK_NO_TAG UINT32_MAX
+/** @brief Time allowed for the handshake. */
+#define HTTP_LINK_CONNECT_TIMEOUT_MS 3000
+/** @brief Time allowed for the response to the oldest outstanding request. */
+#define HTTP_LINK_RESPONSE_TIMEOUT_MS 5000
+/** @brief First backoff after a failure; doubles with each consecutive failure. */
+#define HTTP_LINK_BACKOFF_MIN_MS 500
+/** @brief Longest backoff. */
+#define HTTP_LINK_BACKOFF_MAX_MS 30000
+/** @brief Idle time before TCP keep-alive probes check a silent connection. */
+#define HTTP_LINK_KEEPALIVE_IDLE_MS 10000
+/** @brief Interval between TCP keep-alive probes. */
+#define HTTP_LINK_KEEPALIVE_INTERVAL_MS 2000
+/** @brief Unanswered keep-alive probes before the connection is dropped. */
+#define HTTP_LINK_KEEPALIVE_COUNT 3
+
+/**
+ * @brief Client state.
+ */
+typedef enum
+{
+    HTTP_LINK_IDLE,              ///< No connection; the next request connects.
+    HTTP_LINK_CONNECTING,        ///< Handshake in progress; requests wait in their slots.
+    HTTP_LINK_SENDING,           ///< Connected with room in the window; requests are written right away.
+    HTTP_LINK_AWAITING_RESPONSE, ///< Connected with the window full; waiting for responses.
+    HTTP_LINK_BACKOFF,           ///< Waiting before reconnecting after a failure.
+} HTTP_LINK_STATE_T;
+
+/**
+ * @brief One outstanding request.
+ */
+typedef struct
+{
+    char data[HTTP_LINK_REQUEST_MAX]; ///< Private copy of the request.
+    uint16_t len;                     ///< Request length.
+    uint8_t attempts;                 ///< Times it was written.
+    bool written;                     ///< Written on the current connection.
+    uint64_t written_us;              ///< When it was last written.
+    uint64_t stamp_us;                ///< Caller's send time (identifies the request in clock samples).
+    uint32_t tag;                     ///< Caller's tag, or HTTP_LINK_NO_TAG.
+} HTTP_LINK_SLOT_T;
+
+/**
+ * @brief Connection manager state and counters.
+ */
+typedef struct
+{
+    struct tcp_pcb *pcb;                     ///< Connection PCB (NULL when not connected).
+    HTTP_LINK_STATE_T state;                 ///< Client state.
+    ip_addr_t server_ip;                     ///< Server address.
+    uint16_t server_port;                    ///< Server port.
+    bool has_server;                         ///< `server_ip` and `server_port` are set.
+    HTTP_LINK_SLOT_T slots[HTTP_LINK_WINDOW]; ///< Outstanding requests (ring, oldest at `first`).
+    uint8_t first;                           ///< Slot of the oldest outstanding request.
+    uint8_t used;                            ///< Outstanding requests.
+    HTTP_RESPONSE_T response;                ///< Parser for the responses on the current connection.
+    uint8_t failures_in_row;                 ///< Consecutive failures (sets the backoff).
+    uint64_t deadline_us;                    ///< End of the connect timeout or of the backoff.
+    uint64_t clock_sent_us;                  ///< Stamp of the last request answered at the first try (0 until then).
+    uint64_t clock_answered_us;              ///< When the response to that request completed.
+    uint32_t answered[HTTP_LINK_WINDOW];     ///< Tags of answered requests, oldest first.
+    uint8_t answered_count;                  ///< Tags in `answered`.
+    uint32_t pcb_requests;                   ///< Requests written on the current connection.
+    uint32_t connects;                       ///< Completed handshakes.
+    uint32_t requests;                       ///< Requests written (including retries).
+    uint32_t reused;                         ///< Requests written on an already used connection (handshakes saved).
+    uint32_t responses;                      ///< Successful (2xx) responses.
+    uint32_t rejected;                       ///< Requests refused for good (4xx).
+    uint32_t server_errors;                  ///< Responses asking for a retry (5xx, 408, 429).
+    uint32_t parse_errors;                   ///< Malformed responses (the connection is reset).
+    uint16_t last_status;                    ///< Status code of the last response.
+    uint32_t drops;                          ///< Connections closed by the server.
+    uint32_t failures;                       ///< Connections refused or lost to errors.
+    uint32_t timeouts;                       ///< Connects or responses that took too long.
+    uint32_t retries;                        ///< Requests written again after a failed connection.
+    uint32_t lost;                           ///< Untagged requests given up after HTTP_LINK_MAX_ATTEMPTS.
+} HTTP_LINK_T;
+
+/**
+ * @brief Initializes the manager; the connection is opened by the first request.
+ * @param link Manager to initialize.
+ */
+void http_link_init(HTTP_LINK_T *link);
+
+/**
+ * @brief Sets the server; a different one drops the current connection.
+ *
+ * Unanswered requests are written again on the connection to the new server,
+ * which is opened right away (any backoff is cancelled). Setting the same
+ * server again does nothing, so it can be called on every loop.
+ *
+ * @param link Manager state.
+ * @param server_ip Server address.
+ * @param server_port Server TCP port.
+ */
+void http_link_set_server(HTTP_LINK_T *link, const ip_addr_t *server_ip, uint16_t server_port);
+
+/**
+ * @brief Queues a complete HTTP request on the persistent connection.
+ *
+ * The request is copied into a window slot and written as soon as the
+ * connection can take it.
+ *
+ * @param link Manager state.
+ * @param request Request bytes (headers and body).
+ * @param len Request length.
+ * @param stamp_us Send time written in the request, reported back in the clock sample.
+ * @param tag Reported by `http_link_take_answered` once the server answers, or HTTP_LINK_NO_TAG.
+ * @return false if the request is too large, the window is full or the link
+ *         is backing off; the caller keeps the data.
+ */
+bool http_link_send(HTTP_LINK_T *link, const char *request, uint16_t len, uint64_t stamp_us, uint32_t tag);
+
+/**
+ * @brief Takes the tag of the oldest tagged request the server answered (2xx, or 4xx for good).
+ *
+ * Call it on every loop: the queue holds HTTP_LINK_WINDOW tags, and a tag that
+ * does not fit is not reported.
+ *
+ * @param link Manager state.
+ * @param tag Receives the tag.
+ * @return false if no answer is waiting.
+ */
+bool http_link_take_answered(HTTP_LINK_T *link, uint32_t *tag);
+
+/**
+ * @brief Counts the tagged requests still waiting for an answer.
+ * @param link Manager state.
+ * @return Tagged requests in the window.
+ */
+uint8_t http_link_tagged(const HTTP_LINK_T *link);
+
+/**
+ * @brief Checks whether `http_link_send` would accept a request now.
+ * @param link Manager state.
+ * @return true if the server is known, there is room in the window and the
+ *         link is not backing off.
+ */
+bool http_link_ready(const HTTP_LINK_T *link);
+
+/**
+ * @brief Enforces the connect and response timeouts and ends the backoff.
+ * @param link Manager state.
+ * @param now_us Current time (`time_us_64()`).
+ */
+void http_link_poll(HTTP_LINK_T *link, uint64_t now_us);
+
+/**
+ * @brief Time of the next timeout or end of backoff, for sleeping until then.
+ * @param link Manager state.
+ * @return Absolute time in microseconds, or UINT64_MAX if nothing is pending.
+ */
+uint64_t http_link_next_event_us(const HTTP_LINK_T *link);
+
+/**
+ * @brief Short name of a state, for logs.
+ * @param state Client state.
+ * @return Constant string.
+ */
+const char *http_link_state_name(HTTP_LINK_STATE_T state);
+
+#endif
@@ -0,0 +1,291 @@
+#include "http_response.h"
+
+#include <string.h>
+
+/** @brief Part of a status line, header line or chunk size line being read. */
+enum
+{
+    FIELD_VERSION = 0,       ///< Status line: "HTTP/1.x".
+    FIELD_CODE,              ///< Status line: three-digit code.
+    FIELD_REASON,            ///< Status line: reason phrase (ignored).
+    FIELD_NAME = 0,          ///< Header line: name, matched against `header_names`.
+    FIELD_IGNORE,            ///< Header value or chunk extension that is not needed.
+    FIELD_CONTENT_LENGTH,    ///< Header value: `Content-Length`.
+    FIELD_TRANSFER_ENCODING, ///< Header value: `Transfer-Encoding`.
+    FIELD_CONNECTION,        ///< Header value: `Connection`.
+};
+
+/** @brief Headers that matter, in the order of the FIELD_* value fields (lowercase). */
+static const char *const header_names[] = {"content-length", "transfer-encoding", "connection"};
+
+/** @brief Header values that matter, one per entry of `header_names` (NULL for numbers). */
+static const char *const header_tokens[] = {NULL, "chunked", "close"};
+
+/** @brief Marks a token value that stopped matching. */
+#define TOKEN_MISMATCH 0xFF
+
+static char to_lower(char c)
+{
+    return (c >= 'A' && c <= 'Z') ? (char)(c - 'A' + 'a') : c;
+}
+
+static int hex_value(char c)
+{
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    c = to_lower(c);
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    return -1;
+}
+
+/**
+ * @brief Clears the fields of the previous response.
+ */
+static void http_response_begin(HTTP_RESPONSE_T *response)
+{
+    response->state = HTTP_RESPONSE_STATUS;
+    response->status = 0;
+    response->content_length = -1;
+    response->chunked = false;
+    response->close = false;
+    response->remaining = 0;
+    response->pos = 0;
+    response->field = FIELD_VERSION;
+    response->digits = 0;
+}
+
+static void http_response_status_byte(HTTP_RESPONSE_T *response, char c)
+{
+    if (response->pos < 5)
+    {
+        if (c != "HTTP/"[response->pos])
+            response->state = HTTP_RESPONSE_ERROR;
+        return;
+    }
+
+    switch (response->field)
+    {
+    case FIELD_VERSION:
+        if (c == ' ')
+            response->field = FIELD_CODE;
+        break;
+    case FIELD_CODE:
+        if (c >= '0' && c <= '9' && response->digits < 3)
+        {
+            response->status = (uint16_t)(response->status * 10 + (c - '0'));
+            response->digits++;
+        }
+        else if (c == ' ' && response->digits == 3)
+            response->field = FIELD_REASON;
+        else
+            response->state = HTTP_RESPONSE_ERROR;
+        break;
+    default: // Reason phrase
+        break;
+    }
+}
+
+static void http_response_header_byte(HTTP_RESPONSE_T *response, char c)
+{
+    if (response->pos == 0)
+    {
+        response->field = FIELD_NAME;
+        response->candidates = (1u << (sizeof(header_names) / sizeof(header_names[0]))) - 1;
+        response->digits = 0;
+    }
+
+    if (response->field == FIELD_NAME)
+    {
+        if (c == ':')
+        {
+            response->field = FIELD_IGNORE;
+            for (uint8_t k = 0; k < sizeof(header_names) / sizeof(header_names[0]); ++k)
+                if ((response->candidates & (1u << k)) && strlen(header_names[k]) == response->pos)
+                    response->field = FIELD_CONTENT_LENGTH + k;
+            return;
+        }
+
+        for (uint8_t k = 0; k < sizeof(header_names) / sizeof(header_names[0]); ++k)
+            if (response->pos >= strlen(header_names[k]) || header_names[k][response->pos] != to_lower(c))
+                response->candidates &= (uint8_t)~(1u << k);
+        return;
+    }
+
+    if (response->field == FIELD_IGNORE)
+        return;
+    if ((c == ' ' || c == '\t') && response->digits == 0)
+        return; // Whitespace before the value
+
+    if (response->field == FIELD_CONTENT_LENGTH)
+    {
+        if (c >= '0' && c <= '9' && response->digits < 9)
+        {
+            response->content_length = (response->digits ? response->content_length * 10 : 0) + (c - '0');
+            response->digits++;
+        }
+        else if (c != ' ' && c != '\t')
+            response->state = HTTP_RESPONSE_ERROR;
+        return;
+    }
+
+    const char *token = header_tokens[response->field - FIELD_CONTENT_LENGTH];
+    if (response->digits == TOKEN_MISMATCH)
+        return;
+    if (response->digits < strlen(token) && token[response->digits] == to_lower(c))
+        response->digits++;
+    else
+        response->digits = TOKEN_MISMATCH;
+}
+
+static void http_response_chunk_size_byte(HTTP_RESPONSE_T *response, char c)
+{
+    if (response->field == FIELD_IGNORE)
+        return; // Chunk extension
+
+    int value = hex_value(c);
+    if (value >= 0 && response->digits < 7)
+    {
+        response->remaining = response->remaining * 16 + (uint32_t)value;
+        response->digits++;
+    }
+    else if (c == ';' || c == ' ')
+        response->field = FIELD_IGNORE;
+    else
+        response->state = HTTP_RESPONSE_ERROR;
+}
+
+/**
+ * @brief Ends the header block: picks the body framing.
+ */
+static void http_response_headers_end(HTTP_RESPONSE_T *response)
+{
+    if (response->status < 200)
+    {
+        http_response_begin(response); // Informational (1xx): the real response follows
+        return;
+    }
+
+    if (response->status == 204 || response->status == 304)
+        response->state = HTTP_RESPONSE_DONE;
+    else if (response->chunked)
+        response->state = HTTP_RESPONSE_CHUNK_SIZE;
+    else if (response->content_length >= 0)
+    {
+        response->remaining = (uint32_t)response->content_length;
+        response->state = response->remaining ? HTTP_RESPONSE_BODY : HTTP_RESPONSE_DONE;
+    }
+    else
+    {
+        // No framing: the body ends when the server closes; the caller drops the connection
+        response->close = true;
+        response->state = HTTP_RESPONSE_DONE;
+    }
+}
+
+static void http_response_line_end(HTTP_RESPONSE_T *response)
+{
+    switch (response->state)
+    {
+    case HTTP_RESPONSE_STATUS:
+        if (response->digits != 3)
+        {
+            response->state = HTTP_RESPONSE_ERROR;
+            return;
+        }
+        response->state = HTTP_RESPONSE_HEADERS;
+        break;
+    case HTTP_RESPONSE_HEADERS:
+        if (response->pos == 0)
+        {
+            http_response_headers_end(response);
+            break;
+        }
+        if (response->field == FIELD_TRANSFER_ENCODING && response->digits == strlen(header_tokens[1]))
+            response->chunked = true;
+        else if (response->field == FIELD_CONNECTION && response->digits == strlen(header_tokens[2]))
+            response->close = true;
+        break;
+    case HTTP_RESPONSE_CHUNK_SIZE:
+        if (response->digits == 0)
+        {
+            response->state = HTTP_RESPONSE_ERROR;
+            return;
+        }
+        response->state = response->remaining ? HTTP_RESPONSE_CHUNK_DATA : HTTP_RESPONSE_TRAILERS;
+        break;
+    case HTTP_RESPONSE_CHUNK_END:
+        response->state = HTTP_RESPONSE_CHUNK_SIZE;
+        break;
+    case HTTP_RESPONSE_TRAILERS:
+        if (response->pos == 0)
+            response->state = HTTP_RESPONSE_DONE;
+        break;
+    default:
+        break;
+    }
+
+    response->pos = 0;
+    response->field = 0;
+    response->digits = 0;
+}
+
+static void http_response_line_byte(HTTP_RESPONSE_T *response, char c)
+{
+    if (c == '\r')
+        return; // Lines end at LF; a bare LF is accepted too
+    if (c == '\n')
+    {
+        http_response_line_end(response);
+        return;
+    }
+
+    switch (response->state)
+    {
+    case HTTP_RESPONSE_STATUS:
+        http_response_status_byte(response, c);
+        break;
+    case HTTP_RESPONSE_HEADERS:
+        http_response_header_byte(response, c);
+        break;
+    case HTTP_RESPONSE_CHUNK_SIZE:
+        http_response_chunk_size_byte(response, c);
+        break;
+    case HTTP_RESPONSE_CHUNK_END:
+        response->state = HTTP_RESPONSE_ERROR; // Chunk longer than announced
+        break;
+    default: // Trailer lines are ignored
+        break;
+    }
+    if (response->pos < UINT16_MAX)
+        response->pos++;
+}
+
+void http_response_reset(HTTP_RESPONSE_T *response)
+{
+    http_response_begin(response);
+}
+
+size_t http_response_feed(HTTP_RESPONSE_T *response, const char *data, size_t len)
+{
+    size_t i = 0;
+
+    if (response->state == HTTP_RESPONSE_DONE)
+        http_response_begin(response);
+
+    while (i < len && response->state != HTTP_RESPONSE_DONE && response->state != HTTP_RESPONSE_ERROR)
+    {
+        if (response->state == HTTP_RESPONSE_BODY || response->state == HTTP_RESPONSE_CHUNK_DATA)
+        { // Skip the body in one step, without looking at it
+            size_t skip = len - i < response->remaining ? len - i : response->remaining;
+            i += skip;
+            response->remaining -= (uint32_t)skip;
+            if (response->remaining == 0)
+                response->state = response->state == HTTP_RESPONSE_BODY ? HTTP_RESPONSE_DONE : HTTP_RESPONSE_CHUNK_END;
+            continue;
+        }
+
+        http_response_line_byte(response, data[i++]);
+    }
+    return i;
+}
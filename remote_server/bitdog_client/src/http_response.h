@@ -0,0 +1,71 @@
+/**
+ * @file http_response.h
+ * @brief Incremental HTTP/1.1 response parser.
+ *
+ * Bytes are fed as they arrive (pbuf by pbuf), with no copy and no line
+ * buffer: the status line gives the status code, `Content-Length` and
+ * `Transfer-Encoding: chunked` give the body framing, and the body itself is
+ * only skipped over. Feeding stops right after each complete response, so
+ * pipelined responses can be handled one by one.
+ */
+
+#ifndef HTTP_RESPONSE_H
+#define HTTP_RESPONSE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Parser state.
+ */
+typedef enum
+{
+    HTTP_RESPONSE_STATUS,       ///< Status line.
+    HTTP_RESPONSE_HEADERS,      ///< Header lines.
+    HTTP_RESPONSE_BODY,         ///< Body of known length.
+    HTTP_RESPONSE_CHUNK_SIZE,   ///< Chunk size line.
+    HTTP_RESPONSE_CHUNK_DATA,   ///< Chunk data.
+    HTTP_RESPONSE_CHUNK_END,    ///< CRLF after the chunk data.
+    HTTP_RESPONSE_TRAILERS,     ///< Trailer lines after the last chunk.
+    HTTP_RESPONSE_DONE,         ///< Response complete; the next byte starts a new one.
+    HTTP_RESPONSE_ERROR,        ///< Malformed response; only a new connection recovers.
+} HTTP_RESPONSE_STATE_T;
+
+/**
+ * @brief Parser state and the fields of the current response.
+ */
+typedef struct
+{
+    HTTP_RESPONSE_STATE_T state; ///< Parser state.
+    uint16_t status;             ///< Status code (valid once the headers started).
+    int32_t content_length;      ///< `Content-Length`, or -1 if absent.
+    bool chunked;                ///< `Transfer-Encoding: chunked`.
+    bool close;                  ///< `Connection: close`, or a body without framing that lasts until the close.
+    uint32_t remaining;          ///< Body or chunk bytes still to skip.
+    uint16_t pos;                ///< Bytes read in the current line (CR excluded).
+    uint8_t field;               ///< Part of the line being read (internal).
+    uint8_t candidates;          ///< Header names still matching the current line (internal).
+    uint8_t digits;              ///< Digits or token bytes matched in the current value (internal).
+} HTTP_RESPONSE_T;
+
+/**
+ * @brief Prepares the parser for the first response of a connection.
+ * @param response Parser to reset.
+ */
+void http_response_reset(HTTP_RESPONSE_T *response);
+
+/**
+ * @brief Parses response bytes.
+ *
+ * Stops after the byte that completes a response (state DONE, fields of that
+ * response still readable) or at the first malformed byte (state ERROR).
+ *
+ * @param response Parser state.
+ * @param data Received bytes.
+ * @param len Number of bytes.
+ * @return Bytes consumed; feed the rest again after handling a DONE response.
+ */
+size_t http_response_feed(HTTP_RESPONSE_T *response, const char *data, size_t len);
+
+#endif
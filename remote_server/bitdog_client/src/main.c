@@ -1,9 +1,12 @@
+#include <math.h>
 #include <stdio.h>
+#include <string.h>
 
 #include "hardware/adc.h"
 
 #include "pico/stdlib.h"
 #include "pico/cyw43_arch.h"
+#include "pico/rand.h"
 
 // Incluindo bibliotecas de hardware
 #include "hardware/pwm.h" // PWM
@@ -15,15 +18,27 @@
 
 #include "drivers/display.h"
 #include "drivers/wifi.h"
+#include "drivers/wifi_pm.h"
 #include "drivers/temp.h"
+#include "drivers/joystick.h"
+#include "drivers/wind_rose.h"
+#include "drivers/compass.h"
+
+#include "readings.h"
+#include "change_detector.h"
+#include "sampler.h"
+#include "http_link.h"
+#include "batch.h"
+#include "flash_log.h"
+#include "udp_link.h"
+#include "server_config.h"
+#include "resolver.h"
+#include "console.h"
 
 /** @file main.c
  *  @brief Pico W HTTP client for sending sensor data (joystick, buttons, temperature).
  */
 
-/** @brief GPIO pin for Joystick (ADC0, typically Y-axis). */
-#define JOY_DIR_PIN 26
-
 /** @brief GPIO pin for Red LED (PWM). */
 #define RED_LED_PIN 13
 /** @brief GPIO pin for Blue LED (PWM). */
@@ -34,31 +49,88 @@
 /** @brief GPIO pin for Button B. */
 #define BTB 6
 
+/** @brief Retained display screen with the network status. */
+#define STATUS_SCREEN 1
+/** @brief Retained display screen with the wind rose compass. */
+#define COMPASS_SCREEN 2
+
 /** @brief PWM period (wrap value). */
 const uint16_t PERIOD_PWM = 255;
 /** @brief PWM clock divider. */
 const float DIVIDER_PWM = 16;
 
-/** @brief TCP client Protocol Control Block. */
-struct tcp_pcb *client_pcb = {0};
-
-/** @brief Server witch the data will be sent. */
-#define HTTP_SERVER "192.168.181.161"
-#define HTTP_SERVER_PORT 5000
-#define DATA_ENDPOINT "/update_readings"
-
 /**
- * @brief Stores sensor readings.
+ * @brief Transport for the live readings: 0 = HTTP POSTs on the keep-alive link,
+ *        1 = one UDP datagram per batch (no acknowledgement, loss counted by the server).
+ *        The flash log is always replayed over HTTP, where each page is acknowledged.
  */
-typedef struct
-{
-    float analog_x;    ///< Joystick X-axis value (-1.0 to 1.0).
-    float analog_y;    ///< Joystick Y-axis value (-1.0 to 1.0).
-    float temperature; ///< Internal temperature (°C).
-    uint8_t button_a;  ///< Button A state (1 if pressed).
-    uint8_t button_b;  ///< Button B state (1 if pressed).
+#ifndef CLIENT_USE_UDP
+#define CLIENT_USE_UDP 0
+#endif
+
+/** @brief Display refresh period (independent of the sampling rate). */
+#define DISPLAY_REFRESH_MS 1000
+
+/** @brief Period of the statistics log (at 50 Hz, one block per reading would flood the console). */
+#define STATS_LOG_INTERVAL_MS 1000
+
+/** @brief Wind rose classification state (keeps the hysteresis between readings). */
+wind_rose_t wind_rose;
+
+/** @brief Decides which readings are sent; also holds the published/suppressed counters. */
+CHANGE_DETECTOR_T change_detector;
+
+/** @brief Adaptive sampling scheduler (rate follows joystick activity). */
+SAMPLER_T sampler;
+
+/** @brief Wi-Fi connection supervisor (reconnects on its own, counts the outages). */
+wifi_supervisor_t wifi;
+
+/** @brief Radio power-save policy (low latency while readings flow, deeper sleep when idle). */
+wifi_pm_t wifi_pm;
+
+/** @brief Persistent connection the readings are posted on. */
+HTTP_LINK_T http_link;
+
+/** @brief Datagram publisher (used when CLIENT_USE_UDP is 1). */
+UDP_LINK_T udp_link;
+
+#if CLIENT_USE_UDP
+/** @brief Change thresholds over UDP: datagrams are cheap, so readings may go out at the full sampling rate. */
+static const CHANGE_DETECTOR_CONFIG_T udp_change_config = {
+    .joystick_deadband = CHANGE_JOYSTICK_DEADBAND,
+    .temperature_deadband = CHANGE_TEMPERATURE_DEADBAND,
+    .heartbeat_ms = CHANGE_HEARTBEAT_MS,
+    .min_interval_ms = 1000 / SAMPLER_MAX_RATE_HZ,
+};
+
+/** @brief Batch limits over UDP: a short window keeps latency low at high rates. */
+static const BATCH_CONFIG_T udp_batch_config = {
+    .size = BATCH_SIZE,
+    .max_latency_ms = 100,
+};
+#endif
+
+/** @brief Server endpoint (flash record or the SERVER_CONFIG_DEFAULT_* values). */
+SERVER_CONFIG_T server_config;
+
+/** @brief Cached address of the server hostname. */
+RESOLVER_T resolver;
+
+/** @brief Serial console the server endpoint is changed from. */
+CONSOLE_T console;
 
-} SENSOR_DATA_T;
+/** @brief Random number drawn at boot: a new value tells the server its clock samples are void. */
+uint32_t boot_id;
+
+/** @brief Time spent serializing and handing readings to the network (CPU cost of the transport). */
+uint64_t transport_us;
+
+/** @brief Published readings waiting to be posted together. */
+BATCH_T batch;
+
+/** @brief Readings kept in flash while the server cannot be reached. */
+FLASH_LOG_T flash_log;
 
 /**
  * @brief Configures PWM for Red and Blue LEDs.
@@ -87,74 +159,143 @@ void setup_pwm()
 }
 
 /**
- * @brief Initializes ADC and joystick GPIO pin (ADC0).
+ * @brief Deinitializes Wi-Fi architecture.
  */
-void setup_joystick()
+void deinit_wifi()
 {
-    adc_init();
-    adc_gpio_init(JOY_DIR_PIN); // Configures GPIO26 (ADC0)
+    cyw43_arch_deinit();
 }
 
 /**
- * @brief Reads and normalizes joystick X-axis value (ADC1).
- * @return float Normalized X-axis value (-1.0 to 1.0).
+ * @brief Initializes button GPIOs as inputs with pull-ups.
  */
-float read_analog_x()
+void init_buttons()
 {
-    adc_select_input(1); // ADC1 for X-axis
-    uint16_t raw_value = adc_read();
-    uint16_t dead_zone = 400;
-    float joy_x;
-
-    if (raw_value > (2048 + dead_zone))
-        joy_x = (float)(raw_value - 2048 - dead_zone) / (2047.0 - dead_zone);
-    else if (raw_value < (2048 - dead_zone))
-        joy_x = (float)(raw_value - 2048 + dead_zone) / (2047.0 - dead_zone);
-    else
-        joy_x = 0;
-    return joy_x;
+    gpio_init(BTA);
+    gpio_set_dir(BTA, GPIO_IN);
+    gpio_pull_up(BTA);
+
+    gpio_init(BTB);
+    gpio_set_dir(BTB, GPIO_IN);
+    gpio_pull_up(BTB);
 }
 
 /**
- * @brief Reads and normalizes joystick Y-axis value (ADC0).
- * @return float Normalized Y-axis value (-1.0 to 1.0).
+ * @brief Runs the joystick calibration when both buttons are held during boot.
+ * @note The stick must be left at rest while the buttons are held (center and
+ *       noise are measured first) and then swept through its whole range.
  */
-float read_analog_y()
+void check_joystick_calibration()
 {
-    adc_select_input(0); // ADC0 for Y-axis
-    uint16_t raw_value = adc_read();
-    uint16_t dead_zone = 400;
-    float joy_y;
-
-    if (raw_value > (2048 + dead_zone))
-        joy_y = (float)(raw_value - 2048 - dead_zone) / (2047.0 - dead_zone);
-    else if (raw_value < (2048 - dead_zone))
-        joy_y = (float)(raw_value - 2048 + dead_zone) / (2047.0 - dead_zone);
-    else
-        joy_y = 0;
-    return joy_y;
+    if (gpio_get(BTA) || gpio_get(BTB)) // Pull-up: a pressed button reads 0
+        return;
+
+    show("Calibrando...", false);
+    show("Gire o joystick", false);
+    display_flush(); // The sweep blocks the main loop: present the prompt now
+    bool saved = joystick_calibrate(JOYSTICK_CALIBRATION_SWEEP_MS);
+    clear_display(true);
+    show(saved ? "Calibrado!" : "Falha na calib.", false);
+    display_flush();
+    clear_display(true);
 }
 
 /**
- * @brief Deinitializes Wi-Fi architecture.
+ * @brief Runs the `temp` console command.
+ * @param line `temp` shows the raw ADC reading and the converted temperature (note them at two
+ *        known temperatures); `temp <raw1> <c1> <raw2> <c2>` stores that two-point calibration
+ *        (temperatures in °C) in flash and applies it right away.
  */
-void deinit_wifi()
+static void handle_temp_command(const char *line)
 {
-    cyw43_arch_deinit();
+    unsigned raw_low, raw_high;
+    float c_low, c_high;
+    int end = 0;
+
+    if (strcmp(line, "temp") != 0)
+    {
+        if (sscanf(line, "temp %u %f %u %f %n", &raw_low, &c_low, &raw_high, &c_high, &end) != 4 ||
+            line[end] != '\0' || raw_low > 4095 || raw_high > 4095 || c_low < -50.0f || c_low > 150.0f ||
+            c_high < -50.0f || c_high > 150.0f)
+        {
+            printf("Uso: temp <bruto1> <graus1> <bruto2> <graus2> (bruto 0-4095, graus -50 a 150)\n");
+            return;
+        }
+
+        temp_calibration_t cal = {
+            .raw_low = (uint16_t)raw_low,
+            .centi_low = (int16_t)lroundf(c_low * 100.0f),
+            .raw_high = (uint16_t)raw_high,
+            .centi_high = (int16_t)lroundf(c_high * 100.0f),
+        };
+        if (!temp_set_calibration(&cal))
+        {
+            printf("Calibração recusada ou não gravada (os dois pontos devem ser distintos)\n");
+            return;
+        }
+        printf("Calibração de temperatura gravada\n");
+    }
+
+    uint16_t raw = read_temperature_raw();
+    printf("Temperatura: bruto=%u %.2f °C\n", raw, TEMP_CENTI_TO_FLOAT(temp_raw_to_centi(raw)));
 }
 
 /**
- * @brief Initializes button GPIOs as inputs with pull-ups.
+ * @brief Runs a serial console command.
+ * @param line Command line: `server` shows the endpoint; `server <host|port|udp|path> <value>`
+ *        changes one field, saves it to flash and applies it right away. `pm` shows the radio
+ *        power-save profile and `pm <latencia|equilibrio|economia>` switches and saves it.
+ *        `temp` shows and calibrates the temperature sensor (see handle_temp_command()).
  */
-void init_buttons()
+void handle_command(const char *line)
 {
-    gpio_init(BTA);
-    gpio_set_dir(BTA, GPIO_IN);
-    gpio_pull_up(BTA);
+    if (strcmp(line, "temp") == 0 || strncmp(line, "temp ", 5) == 0)
+    {
+        handle_temp_command(line);
+        return;
+    }
 
-    gpio_init(BTB);
-    gpio_set_dir(BTB, GPIO_IN);
-    gpio_pull_up(BTB);
+    if (strcmp(line, "pm") == 0 || strncmp(line, "pm ", 3) == 0)
+    {
+        if (line[2] && !wifi_pm_set_profile(&wifi_pm, line + 3))
+            printf("Perfil desconhecido: %s (latencia, equilibrio ou economia)\n", line + 3);
+        printf("Energia: perfil=%s modo=%s\n", wifi_pm_profile_name(wifi_pm.profile), wifi_pm_mode_name(wifi_pm.mode));
+        return;
+    }
+
+    char key[8];
+    char value[SERVER_CONFIG_HOST_MAX > SERVER_CONFIG_PATH_MAX ? SERVER_CONFIG_HOST_MAX : SERVER_CONFIG_PATH_MAX];
+    int fields = sscanf(line, "server %7s %63s", key, value);
+
+    if (strcmp(line, "server") == 0)
+    {
+        server_config_print(&server_config);
+        return;
+    }
+    if (fields != 2)
+    {
+        printf("Uso: server [host|port|udp|path <valor>], pm [latencia|equilibrio|economia] ou temp [...]\n");
+        return;
+    }
+
+    SERVER_CONFIG_T config = server_config;
+    if (!server_config_set(&config, key, value))
+    {
+        printf("Valor inválido para %s: %s\n", key, value);
+        return;
+    }
+    if (!server_config_save(&config))
+        printf("Erro ao gravar o servidor na flash (vale até reiniciar)\n");
+
+    bool host_changed = strcmp(config.host, server_config.host) != 0;
+    server_config = config;
+    if (host_changed)
+    { // The links move over once it resolves
+        cyw43_arch_lwip_begin(); // A lookup of the old host may still be answered in the background
+        resolver_init(&resolver, server_config.host);
+        cyw43_arch_lwip_end();
+    }
+    server_config_print(&server_config);
 }
 
 /**
@@ -163,36 +304,96 @@ void init_buttons()
 void setup()
 {
     stdio_init_all();
+    boot_id = get_rand_32();
     init_display();
     init_wifi_sta();
-    connect_to_wifi();
+    wifi_supervisor_init(&wifi); // Connects in the background: sampling starts right away
+    wifi_pm_init(&wifi_pm);
     init_temp_sensor();
 
-    adc_init();                        // General ADC init
-    adc_set_temp_sensor_enabled(true); // Enable internal temperature sensor (ADC4)
-
     init_buttons();
-    setup_joystick();
+    joystick_init(); // Initializes ADC for joystick and loads its calibration
+    check_joystick_calibration();
+    wind_rose_init(&wind_rose);
+    sampler_init(&sampler, NULL);
+#if CLIENT_USE_UDP
+    change_detector_init(&change_detector, &udp_change_config);
+    batch_init(&batch, &udp_batch_config);
+    cyw43_arch_lwip_begin(); // Creates the PCB
+    udp_link_init(&udp_link);
+    cyw43_arch_lwip_end();
+#else
+    change_detector_init(&change_detector, NULL);
+    batch_init(&batch, NULL);
+#endif
+    http_link_init(&http_link);
+    if (!server_config_load(&server_config))
+        printf("Servidor padrão (altere com: server host <nome>)\n");
+    server_config_print(&server_config);
+    resolver_init(&resolver, server_config.host);
+    console_init(&console);
+    flash_log_init(&flash_log);
     setup_pwm();
 }
 
+/** @brief Screen currently selected with button B. */
+static uint8_t active_screen = STATUS_SCREEN;
+
 /**
  * @brief Displays Wi-Fi connection status (intended for external display).
- * @note Relies on `show()` and `clear_display()` from `drivers/display.h`.
+ * @note The screen is retained: labels are drawn once and the IP field is
+ *       redrawn only when it changes, so an unchanged screen sends nothing.
  *       Also assumes `WIFI_SSID`, `WIFI_PASSWORD` are defined.
  */
 void show_connection_status()
 {
-    show("-=-REDE-=-=", false);
-    show(WIFI_SSID, false);
-    show(WIFI_PASSWORD, false);
-    char ip_msg[50];
+    static int ip_field = -1;
+
+    if (display_screen_begin(STATUS_SCREEN))
+    {
+        display_label(0, 0, "-=-REDE-=-=");
+        display_label(0, 16, WIFI_SSID);
+        display_label(0, 32, WIFI_PASSWORD);
+        ip_field = display_field(0, 6, SCREEN_WIDTH, &font_small, TEXT_ALIGN_LEFT);
+    }
+
     if (netif_default)
     { // Check if netif_default is valid
+        char ip_msg[50];
         snprintf(ip_msg, sizeof(ip_msg), "IP: %s", ipaddr_ntoa(&netif_default->ip_addr));
-        show(ip_msg, true);
+        display_field_set(ip_field, ip_msg);
+    }
+    display_render();
+}
+
+/**
+ * @brief Toggles the screen on a button B press and refreshes the active one.
+ * @param readings Latest readings, shown by the compass screen.
+ */
+void update_display(const SENSOR_DATA_T *readings)
+{
+    static bool last_button_b = false;
+    bool button_b = !gpio_get(BTB); // Read directly so short presses between samples still count
+
+    if (button_b && !last_button_b)
+        active_screen = active_screen == STATUS_SCREEN ? COMPASS_SCREEN : STATUS_SCREEN;
+    last_button_b = button_b;
+
+    if (active_screen == COMPASS_SCREEN)
+    {
+        compass_view_t view = {
+            .heading = readings->heading,
+            .magnitude = readings->magnitude,
+            .direction = readings->direction,
+            .button_a = readings->button_a,
+            .button_b = readings->button_b,
+        };
+        compass_show(COMPASS_SCREEN, &view);
+    }
+    else
+    {
+        show_connection_status();
     }
-    clear_display(true);
 }
 
 /**
@@ -201,104 +402,261 @@ void show_connection_status()
  */
 void update_readings(SENSOR_DATA_T *readings)
 {
-    readings->analog_x = read_analog_x();
-    readings->analog_y = read_analog_y();
+    readings->analog_x = joystick_read(JOYSTICK_AXIS_X);
+    readings->analog_y = joystick_read(JOYSTICK_AXIS_Y);
+
+    wind_rose_polar_t polar;
+    wind_rose_polar(readings->analog_x, readings->analog_y, &polar);
+    readings->heading = polar.heading;
+    readings->magnitude = polar.magnitude;
+    readings->direction = wind_rose_update(&wind_rose, &polar);
 
-    // Read internal temperature sensor (ADC4)
-    adc_select_input(4);
-    uint16_t temp_raw = adc_read();
-    float conversion_factor = 3.3f / (1 << 12); // ADC is 12-bit
-    float voltage = temp_raw * conversion_factor;
-    readings->temperature = 27.0f - (voltage - 0.706f) / 0.001721f; // Formula from datasheet
+    readings->temperature = read_internal_temperature_centi(); // Internal sensor (ADC4)
 
     readings->button_a = !gpio_get(BTA); // Inverted due to pull-up
     readings->button_b = !gpio_get(BTB); // Inverted due to pull-up
+}
 
-    printf("UPDATE: X=%.2f Y=%.2f A=%d B=%d T=%.2f\n",
-           readings->analog_x, readings->analog_y,
-           readings->button_a, readings->button_b, readings->temperature);
+/**
+ * @brief Logs a reading that is about to be published.
+ * @param readings Reading to log.
+ */
+void log_readings(const SENSOR_DATA_T *readings)
+{
+    uint32_t rate = sampler_rate_centihz(&sampler);
+    printf("UPDATE: X=%.2f Y=%.2f H=%u.%u D=%s A=%d B=%d T=%.2f R=%lu.%02luHz (publicadas=%lu suprimidas=%lu)\n",
+           JOYSTICK_TO_FLOAT(readings->analog_x), JOYSTICK_TO_FLOAT(readings->analog_y),
+           readings->heading / 10, readings->heading % 10, wind_rose_abbrev(readings->direction),
+           readings->button_a, readings->button_b, TEMP_CENTI_TO_FLOAT(readings->temperature),
+           (unsigned long)(rate / 100), (unsigned long)(rate % 100),
+           (unsigned long)change_detector.published, (unsigned long)change_detector.suppressed);
 }
 
-static void http_client_send_post(struct tcp_pcb *tpcb, SENSOR_DATA_T *data)
+/**
+ * @brief Logs the display, transport, Wi-Fi, DNS and flash log counters.
+ */
+void log_stats()
 {
-    char body[512];
-    snprintf(body, sizeof(body),
-             "{\"temp\":%.2f,\"joy_x\":%.2f,\"joy_y\":%.2f,\"btn_a\":%d,\"btn_b\":%d}",
-             data->temperature, data->analog_x, data->analog_y,
-             data->button_a, data->button_b);
-
-    int body_len = strlen(body);
-
-    char request[1024];
-    snprintf(request, sizeof(request),
-             "POST %s HTTP/1.1\r\n"
-             "Host: %s\r\n"
-             "Content-Type: application/json\r\n"
-             "Content-Length: %d\r\n"
-             "Connection: close\r\n\r\n"
-             "%s",
-             DATA_ENDPOINT, HTTP_SERVER, body_len, body);
-
-    tcp_write(tpcb, request, strlen(request), TCP_WRITE_FLAG_COPY);
-    tcp_output(tpcb);
+    const display_stats_t *display_stats = display_get_stats();
+    printf("DISPLAY: quadros=%lu adiados=%lu sem_mudancas=%lu quadro=%luus max=%luus\n",
+           (unsigned long)display_stats->presented, (unsigned long)display_stats->deferred,
+           (unsigned long)display_stats->skipped, (unsigned long)display_stats->frame_us,
+           (unsigned long)display_stats->max_frame_us);
+
+    printf("HTTP: estado=%s em_voo=%u conexoes=%lu requisicoes=%lu respostas=%lu handshakes_poupados=%lu\n",
+           http_link_state_name(http_link.state), http_link.used, (unsigned long)http_link.connects,
+           (unsigned long)http_link.requests, (unsigned long)http_link.responses, (unsigned long)http_link.reused);
+    printf("HTTP: quedas=%lu falhas=%lu timeouts=%lu reenvios=%lu perdidas=%lu\n",
+           (unsigned long)http_link.drops, (unsigned long)http_link.failures, (unsigned long)http_link.timeouts,
+           (unsigned long)http_link.retries, (unsigned long)http_link.lost);
+    printf("HTTP: ultimo_status=%u rejeitadas=%lu erros_servidor=%lu respostas_malformadas=%lu\n",
+           http_link.last_status, (unsigned long)http_link.rejected, (unsigned long)http_link.server_errors,
+           (unsigned long)http_link.parse_errors);
+
+    uint32_t per_request = batch_readings_per_request_centi(&batch);
+    printf("LOTE: leituras/requisicao=%lu.%02lu requisicoes=%lu descartadas=%lu\n",
+           (unsigned long)(per_request / 100), (unsigned long)(per_request % 100),
+           (unsigned long)batch.requests, (unsigned long)batch.overflows);
+
+    uint32_t sent = CLIENT_USE_UDP ? udp_link.readings : batch.readings;
+    printf("TX: %s %lu us/leitura", CLIENT_USE_UDP ? "UDP" : "HTTP",
+           (unsigned long)(sent ? transport_us / sent : 0));
+#if CLIENT_USE_UDP
+    printf(" datagramas=%lu bytes=%lu erros=%lu", (unsigned long)udp_link.datagrams,
+           (unsigned long)udp_link.bytes, (unsigned long)udp_link.errors);
+#endif
+    printf("\n");
+
+    printf("WIFI: estado=%s quedas=%lu tentativas=%lu falhas=%lu pelo_cache=%lu reconexao=%lums (max %lums) "
+           "fora_do_ar=%lums (total %llums)\n",
+           wifi_state_name(wifi.state), (unsigned long)wifi.disconnects, (unsigned long)wifi.attempts,
+           (unsigned long)wifi.failures, (unsigned long)wifi.fast_joins, (unsigned long)wifi.last_reconnect_ms,
+           (unsigned long)wifi.max_reconnect_ms, (unsigned long)wifi.last_downtime_ms,
+           (unsigned long long)wifi.total_downtime_ms);
+    printf("ENERGIA: perfil=%s modo=%s trocas=%lu erros=%lu com_trafego=%llums sem_trafego=%llums\n",
+           wifi_pm_profile_name(wifi_pm.profile), wifi_pm_mode_name(wifi_pm.mode), (unsigned long)wifi_pm.switches,
+           (unsigned long)wifi_pm.errors, (unsigned long long)(wifi_pm.busy_us / 1000),
+           (unsigned long long)(wifi_pm.idle_us / 1000));
+
+    printf("DNS: %s resolvido=%s cache=%lu consultas=%lu falhas=%lu mudancas=%lu\n", resolver.host,
+           resolver.resolved ? ipaddr_ntoa(&resolver.addr) : "-", (unsigned long)resolver.cache_hits,
+           (unsigned long)resolver.queries, (unsigned long)resolver.failures, (unsigned long)resolver.changes);
+
+    printf("LOG: pendentes=%u gravadas=%lu reenviadas=%lu perdidas=%lu\n", flash_log.pending,
+           (unsigned long)flash_log.written, (unsigned long)flash_log.drained, (unsigned long)flash_log.dropped);
 }
 
-static err_t http_client_recv(void *arg, struct tcp_pcb *tpcb, struct pbuf *p, err_t err)
+/**
+ * @brief Posts readings as one JSON array on the persistent connection.
+ * @param entries Readings, oldest first.
+ * @param count Number of readings.
+ * @param tag Flash log page sequence for a replayed page (older than the live state), or HTTP_LINK_NO_TAG.
+ * @return true if the request was handed to the connection.
+ * @note Each reading keeps its capture time (`t_us`, µs since boot). `sent_us`
+ *       is taken last, right before the request is queued, and `clock`
+ *       reports when the previous stamped request was answered, so the server
+ *       can place the capture times on its own clock (see http_link.h).
+ *       `boot` changes on every reboot, when those samples stop being valid.
+ */
+bool post_readings(const BATCH_ENTRY_T *entries, uint8_t count, uint32_t tag)
 {
-    if (!p)
+    static char body[HTTP_LINK_REQUEST_MAX];
+    static char request[HTTP_LINK_REQUEST_MAX];
+    uint32_t rate = sampler_rate_centihz(&sampler);
+    uint32_t per_request = batch_readings_per_request_centi(&batch);
+    size_t body_len = 0;
+
+    body_len += snprintf(body, sizeof(body), "{\"readings\":[");
+    for (uint8_t i = 0; i < count && body_len < sizeof(body); i++)
     {
-        tcp_close(tpcb);
-        return ERR_OK;
+        const BATCH_ENTRY_T *entry = &entries[i];
+        const SENSOR_DATA_T *data = &entry->reading;
+        body_len += snprintf(body + body_len, sizeof(body) - body_len,
+                             "%s{\"t_us\":%llu,\"temp\":%.2f,\"joy_x\":%.2f,\"joy_y\":%.2f,\"heading\":%u.%u,"
+                             "\"mag\":%.2f,\"dir\":%u,\"btn_a\":%d,\"btn_b\":%d}",
+                             i ? "," : "", (unsigned long long)entry->capture_us,
+                             TEMP_CENTI_TO_FLOAT(data->temperature), JOYSTICK_TO_FLOAT(data->analog_x),
+                             JOYSTICK_TO_FLOAT(data->analog_y), data->heading / 10, data->heading % 10,
+                             JOYSTICK_TO_FLOAT(data->magnitude), data->direction, data->button_a, data->button_b);
     }
 
-    // (Opcional) Lê resposta do servidor
-    char *resp = malloc(p->tot_len + 1);
-    pbuf_copy_partial(p, resp, p->tot_len, 0);
-    resp[p->tot_len] = '\0';
-    printf("Resposta do servidor: %s\n", resp);
-    free(resp);
+    if (body_len < sizeof(body))
+        body_len += snprintf(body + body_len, sizeof(body) - body_len,
+                             "],\"published\":%lu,\"suppressed\":%lu,\"rate_hz\":%lu.%02lu,\"connects\":%lu,"
+                             "\"reused\":%lu,\"per_request\":%lu.%02lu,\"replay\":%s,",
+                             (unsigned long)change_detector.published, (unsigned long)change_detector.suppressed,
+                             (unsigned long)(rate / 100), (unsigned long)(rate % 100),
+                             (unsigned long)http_link.connects, (unsigned long)http_link.reused,
+                             (unsigned long)(per_request / 100), (unsigned long)(per_request % 100),
+                             tag != HTTP_LINK_NO_TAG ? "true" : "false");
+    if (body_len < sizeof(body) && http_link.clock_sent_us)
+        body_len += snprintf(body + body_len, sizeof(body) - body_len, "\"clock\":{\"t1\":%llu,\"t4\":%llu},",
+                             (unsigned long long)http_link.clock_sent_us,
+                             (unsigned long long)http_link.clock_answered_us);
+
+    uint64_t sent_us = time_us_64();
+    if (body_len < sizeof(body))
+        body_len += snprintf(body + body_len, sizeof(body) - body_len, "\"boot\":%lu,\"sent_us\":%llu}",
+                             (unsigned long)boot_id, (unsigned long long)sent_us);
+
+    int request_len = snprintf(request, sizeof(request),
+                               "POST %s HTTP/1.1\r\n"
+                               "Host: %s\r\n"
+                               "Content-Type: application/json\r\n"
+                               "Content-Length: %u\r\n"
+                               "Connection: keep-alive\r\n\r\n"
+                               "%s",
+                               server_config.path, server_config.host, (unsigned)body_len, body);
+    if (body_len >= sizeof(body) || request_len >= (int)sizeof(request))
+    {
+        printf("Lote grande demais para a requisição (%u leituras)\n", count);
+        return false;
+    }
 
-    pbuf_free(p);
-    tcp_close(tpcb);
-    return ERR_OK;
+    return http_link_send(&http_link, request, request_len, sent_us, tag);
 }
 
-static err_t http_client_connected(void *arg, struct tcp_pcb *tpcb, err_t err)
+/**
+ * @brief Checks whether the transport can take a batch right now.
+ */
+bool transport_ready()
 {
-    if (err != ERR_OK)
-    {
-        printf("Erro na conexão: %d\n", err);
-        tcp_close(tpcb);
-        return err;
-    }
+#if CLIENT_USE_UDP
+    return udp_link.has_server; // Otherwise nothing to wait for: a datagram is sent or dropped on the spot
+#else
+    return http_link_ready(&http_link);
+#endif
+}
 
-    SENSOR_DATA_T *data = (SENSOR_DATA_T *)arg;
-    tcp_recv(tpcb, http_client_recv); // opcional: tratar resposta
-    http_client_send_post(tpcb, data);
-    return ERR_OK;
+/**
+ * @brief Sends live readings with the configured transport and accounts its CPU time.
+ * @param entries Readings, oldest first.
+ * @param count Number of readings.
+ * @return true if the transport took them.
+ */
+bool publish_readings(const BATCH_ENTRY_T *entries, uint8_t count)
+{
+    uint64_t start_us = time_us_64();
+#if CLIENT_USE_UDP
+    bool sent = udp_link_send(&udp_link, entries, count, false);
+#else
+    bool sent = post_readings(entries, count, HTTP_LINK_NO_TAG);
+#endif
+    transport_us += time_us_64() - start_us;
+    if (sent)
+        wifi_pm_traffic(&wifi_pm, start_us);
+    return sent;
 }
 
-void send_sensor_data(SENSOR_DATA_T *data)
+/**
+ * @brief Posts the live batch, or moves it to the flash log if it cannot be posted.
+ * @param online Whether the Wi-Fi link is up.
+ * @note A due batch is held while the in-flight window is full or the link
+ *       is backing off (it keeps growing meanwhile). Once full, it goes to
+ *       flash instead, so no reading is lost during an outage.
+ */
+void flush_batch(bool online)
 {
-    struct tcp_pcb *pcb = tcp_new();
-    if (!pcb)
+    if (online && transport_ready() && publish_readings(batch.entries, batch.count))
     {
-        printf("Erro ao criar PCB TCP\n");
+        batch_sent(&batch);
         return;
     }
 
-    ip_addr_t server_ip;
-    ipaddr_aton(HTTP_SERVER, &server_ip);
-
-    err_t err = tcp_connect(pcb, &server_ip, HTTP_SERVER_PORT, http_client_connected);
-    if (err != ERR_OK)
-    {
-        printf("Erro ao conectar: %d\n", err);
-        tcp_abort(pcb);
+    if (!batch_full(&batch))
         return;
-    }
 
-    tcp_arg(pcb, data); // Passa o ponteiro dos dados como contexto
+    if (flash_log_append(&flash_log, batch.entries, batch.count))
+        batch_clear(&batch);
+    else
+        printf("Erro ao gravar lote na flash\n");
+}
+
+/**
+ * @brief Marks the replayed pages the server answered as sent.
+ * @note A page stays in flash until then, so a reboot or a lost request replays
+ *       it again. With nothing in flight, the pages handed out and not marked
+ *       (an answer that did not fit the queue, a flash error) are handed out again.
+ */
+void consume_answered()
+{
+    uint32_t sequence;
+    while (http_link_take_answered(&http_link, &sequence))
+        flash_log_consume(&flash_log, sequence);
+    if (http_link_tagged(&http_link) == 0)
+        flash_log_rewind(&flash_log);
+}
+
+/**
+ * @brief Checks whether a flash log page can be replayed now.
+ * @note Pages always go over HTTP, even in UDP builds: a page is only marked
+ *       sent once the server answered it, and a datagram is never answered.
+ *       One window slot is always left for the live batch.
+ */
+bool replay_ready()
+{
+    return http_link_ready(&http_link) && http_link.state != HTTP_LINK_CONNECTING &&
+           http_link.used < HTTP_LINK_WINDOW - 1;
+}
+
+/**
+ * @brief Replays the oldest waiting page of the flash log.
+ * @return true if a page was posted.
+ */
+bool drain_flash_log()
+{
+    if (!replay_ready())
+        return false;
+
+    uint8_t count;
+    uint32_t sequence;
+    const BATCH_ENTRY_T *entries = flash_log_replay(&flash_log, &count, &sequence);
+    uint64_t start_us = time_us_64();
+    if (!entries || !post_readings(entries, count, sequence))
+        return false; // A page handed out and not sent goes out again with the next rewind
+
+    wifi_pm_traffic(&wifi_pm, start_us);
+    return true;
 }
 
 /**
@@ -311,18 +669,107 @@ int main()
 
     SENSOR_DATA_T *readings = (SENSOR_DATA_T *)malloc(sizeof(SENSOR_DATA_T));
 
+    uint64_t next_display_us = 0;
+    uint64_t next_drain_us = 0;
+    uint64_t next_stats_us = 0;
+
     while (true)
     {
         cyw43_arch_poll();
-
-        if (netif_default && netif_is_up(netif_default) && netif_is_link_up(netif_default))
-        { // Check network status
+        uint64_t now_us = time_us_64();
+        uint64_t wake_us = now_us + DISPLAY_REFRESH_MS * 1000;
+        wifi_supervisor_poll(&wifi, now_us);
+        bool online = wifi_supervisor_online(&wifi);
+
+        // Readings go on while offline: they are kept in the flash log until the server is back
+        if (sampler_due(&sampler, now_us))
+        {
+            uint64_t capture_us = time_us_64(); // Latency is measured from here to the server
             update_readings(readings);
-            send_sensor_data(readings);
-            show_connection_status();
-            clear_display(true);
+            sampler_update(&sampler, readings);
+            if (change_detector_check(&change_detector, readings, now_us))
+            {
+                log_readings(readings);
+                batch_add(&batch, readings, capture_us);
+            }
+        }
+
+        if (now_us >= next_stats_us)
+        {
+            log_stats();
+            next_stats_us = now_us + STATS_LOG_INTERVAL_MS * 1000;
+        }
+
+        const char *line = console_poll(&console);
+        if (line)
+            handle_command(line);
+
+        // The lwIP callbacks run in the background and change the links and the resolver:
+        // every call into them from the loop holds the lwIP lock
+        cyw43_arch_lwip_begin();
+
+        // The links always use the cached address: a lookup never holds up a send
+        ip_addr_t server_ip;
+        if (online)
+            resolver_poll(&resolver, now_us);
+        if (resolver_address(&resolver, &server_ip))
+        {
+            http_link_set_server(&http_link, &server_ip, server_config.http_port);
+            udp_link_set_server(&udp_link, &server_ip, server_config.udp_port);
         }
-        sleep_ms(1000);
+
+        http_link_poll(&http_link, now_us); // Timeouts, end of backoff, reconnection
+        consume_answered();
+        if (http_link.used > 0)
+            wifi_pm_traffic(&wifi_pm, now_us); // Keep the radio awake for the responses
+
+        if (batch_due(&batch, now_us))
+            flush_batch(online);
+
+        // Live readings first; the backlog is replayed at a limited pace behind them
+        if (online && flash_log_waiting(&flash_log) && !batch_due(&batch, now_us) && now_us >= next_drain_us &&
+            drain_flash_log())
+            next_drain_us = now_us + FLASH_LOG_DRAIN_INTERVAL_MS * 1000;
+
+        cyw43_arch_lwip_end();
+
+        wifi_pm_poll(&wifi_pm, online, now_us); // Idle long enough: let the radio sleep deeper
+
+        if (now_us >= next_display_us)
+        {
+            update_display(readings);
+            next_display_us = now_us + (active_screen == COMPASS_SCREEN ? COMPASS_REFRESH_MS : DISPLAY_REFRESH_MS) * 1000;
+        }
+
+        if (sampler_next_sample_us(&sampler) < wake_us)
+            wake_us = sampler_next_sample_us(&sampler);
+        if (next_display_us < wake_us)
+            wake_us = next_display_us;
+        if (next_stats_us < wake_us)
+            wake_us = next_stats_us;
+        if (wifi_supervisor_next_event_us(&wifi) < wake_us)
+            wake_us = wifi_supervisor_next_event_us(&wifi);
+        if (online && wifi_pm_next_event_us(&wifi_pm) < wake_us)
+            wake_us = wifi_pm_next_event_us(&wifi_pm);
+
+        cyw43_arch_lwip_begin();
+        if (http_link_next_event_us(&http_link) < wake_us)
+            wake_us = http_link_next_event_us(&http_link);
+        if (online && resolver_next_event_us(&resolver) < wake_us)
+            wake_us = resolver_next_event_us(&resolver);
+        // Otherwise a response, a connection event or the link timer wakes the loop
+        if (online && transport_ready() && batch_deadline_us(&batch) < wake_us)
+            wake_us = batch_deadline_us(&batch);
+        if (online && replay_ready() && flash_log_waiting(&flash_log) && next_drain_us < wake_us)
+            wake_us = next_drain_us;
+        cyw43_arch_lwip_end();
+
+        display_tick(); // Present a frame deferred by the frame rate cap
+        if (display_next_present_us() < wake_us)
+            wake_us = display_next_present_us();
+
+        // Sleep until the next reading or display refresh (Wi-Fi events wake it up earlier).
+        cyw43_arch_wait_for_work_until(from_us_since_boot(wake_us));
     }
 
     free(readings);
@@ -0,0 +1,27 @@
+/**
+ * @file readings.h
+ * @brief Sensor reading snapshot shared by the client modules.
+ */
+
+#ifndef READINGS_H
+#define READINGS_H
+
+#include <stdint.h>
+
+/**
+ * @brief Stores sensor readings.
+ */
+typedef struct
+{
+    int16_t analog_x;    ///< Joystick X-axis value (-JOYSTICK_FULL_SCALE to JOYSTICK_FULL_SCALE).
+    int16_t analog_y;    ///< Joystick Y-axis value (-JOYSTICK_FULL_SCALE to JOYSTICK_FULL_SCALE).
+    uint16_t heading;    ///< Joystick heading in tenths of degree (0 = north, clockwise).
+    uint16_t magnitude;  ///< Joystick deflection (same scale as the axes).
+    uint8_t direction;   ///< Wind rose point (`wind_rose_dir_t`).
+    int16_t temperature; ///< Internal temperature (hundredths of °C).
+    uint8_t button_a;    ///< Button A state (1 if pressed).
+    uint8_t button_b;    ///< Button B state (1 if pressed).
+
+} SENSOR_DATA_T;
+
+#endif
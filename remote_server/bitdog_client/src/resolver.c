@@ -0,0 +1,92 @@
+#include "resolver.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "pico/stdlib.h"
+
+#include "lwip/dns.h"
+
+/**
+ * @brief Keeps a new address and schedules the next lookup.
+ */
+static void resolver_store(RESOLVER_T *resolver, const ip_addr_t *addr)
+{
+    if (!resolver->resolved || !ip_addr_cmp(&resolver->addr, addr))
+    {
+        ip_addr_copy(resolver->addr, *addr);
+        resolver->resolved = true;
+        resolver->changes++;
+        printf("Servidor %s em %s\n", resolver->host, ipaddr_ntoa(addr));
+    }
+    resolver->next_us = time_us_64() + RESOLVER_REFRESH_MS * 1000ull;
+}
+
+static void resolver_found(const char *name, const ip_addr_t *addr, void *arg)
+{
+    RESOLVER_T *resolver = (RESOLVER_T *)arg;
+    if (strcmp(name, resolver->host) != 0)
+        return; // Answer for a hostname replaced in the meantime
+
+    resolver->pending = false;
+    if (!addr)
+    { // Keep using the previous address, if any, until the retry
+        printf("Falha ao resolver %s\n", name);
+        resolver->failures++;
+        resolver->next_us = time_us_64() + RESOLVER_RETRY_MS * 1000ull;
+        return;
+    }
+    resolver_store(resolver, addr);
+}
+
+void resolver_init(RESOLVER_T *resolver, const char *host)
+{
+    memset(resolver, 0, sizeof(*resolver));
+    strncpy(resolver->host, host, sizeof(resolver->host) - 1);
+
+    if (ipaddr_aton(resolver->host, &resolver->addr))
+    {
+        resolver->literal = true;
+        resolver->resolved = true;
+    }
+}
+
+void resolver_poll(RESOLVER_T *resolver, uint64_t now_us)
+{
+    if (resolver->literal || resolver->pending || now_us < resolver->next_us)
+        return;
+
+    ip_addr_t addr;
+    err_t err = dns_gethostbyname(resolver->host, &addr, resolver_found, resolver);
+    if (err == ERR_OK)
+    {
+        resolver->cache_hits++;
+        resolver_store(resolver, &addr);
+    }
+    else if (err == ERR_INPROGRESS)
+    {
+        resolver->queries++;
+        resolver->pending = true; // resolver_found completes it
+    }
+    else
+    {
+        printf("Erro ao consultar DNS para %s: %d\n", resolver->host, err);
+        resolver->failures++;
+        resolver->next_us = now_us + RESOLVER_RETRY_MS * 1000ull;
+    }
+}
+
+bool resolver_address(const RESOLVER_T *resolver, ip_addr_t *addr)
+{
+    if (!resolver->resolved)
+        return false;
+    ip_addr_copy(*addr, resolver->addr);
+    return true;
+}
+
+uint64_t resolver_next_event_us(const RESOLVER_T *resolver)
+{
+    if (resolver->literal || resolver->pending)
+        return UINT64_MAX;
+    return resolver->next_us;
+}
@@ -0,0 +1,77 @@
+/**
+ * @file resolver.h
+ * @brief Non-blocking, cached resolution of the server hostname.
+ *
+ * The hostname goes through lwIP's `dns_gethostbyname`, which answers from its
+ * own table while the record's TTL lasts and otherwise sends a query and calls
+ * back later. The resolver keeps the last address it got, so senders use it
+ * right away and never wait on DNS: the name is looked up again every
+ * RESOLVER_REFRESH_MS (a table hit while the TTL lasts, a new query once it
+ * expired), and after a failed query the old address stays in use until the
+ * retry RESOLVER_RETRY_MS later. A dotted address skips DNS altogether.
+ *
+ * `resolver_poll` must be called from the main loop while the network is up.
+ */
+
+#ifndef RESOLVER_H
+#define RESOLVER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "lwip/ip_addr.h"
+
+#include "server_config.h"
+
+/** @brief Interval between lookups of a resolved name (lwIP's table applies the TTL). */
+#define RESOLVER_REFRESH_MS 30000
+/** @brief Wait before looking up again after a failure. */
+#define RESOLVER_RETRY_MS 5000
+
+/**
+ * @brief Resolver state and counters.
+ */
+typedef struct
+{
+    char host[SERVER_CONFIG_HOST_MAX]; ///< Name being resolved.
+    ip_addr_t addr;                    ///< Last address obtained.
+    bool resolved;                     ///< `addr` is valid.
+    bool literal;                      ///< `host` is a dotted address (no DNS).
+    bool pending;                      ///< A query is in flight.
+    uint64_t next_us;                  ///< Time of the next lookup.
+    uint32_t cache_hits;               ///< Lookups answered from lwIP's table.
+    uint32_t queries;                  ///< Lookups that went to the DNS server.
+    uint32_t failures;                 ///< Queries that failed or timed out.
+    uint32_t changes;                  ///< Times the address changed.
+} RESOLVER_T;
+
+/**
+ * @brief Starts resolving a hostname (forgets the previous one).
+ * @param resolver Resolver to initialize.
+ * @param host Hostname or dotted address.
+ */
+void resolver_init(RESOLVER_T *resolver, const char *host);
+
+/**
+ * @brief Starts a lookup when one is due; never waits for the answer.
+ * @param resolver Resolver state.
+ * @param now_us Current time (`time_us_64()`).
+ */
+void resolver_poll(RESOLVER_T *resolver, uint64_t now_us);
+
+/**
+ * @brief Gets the cached address.
+ * @param resolver Resolver state.
+ * @param addr Destination.
+ * @return false while the name was never resolved.
+ */
+bool resolver_address(const RESOLVER_T *resolver, ip_addr_t *addr);
+
+/**
+ * @brief Time of the next lookup, for sleeping until then.
+ * @param resolver Resolver state.
+ * @return Absolute time in microseconds, or UINT64_MAX if nothing is pending.
+ */
+uint64_t resolver_next_event_us(const RESOLVER_T *resolver);
+
+#endif
@@ -0,0 +1,77 @@
+#include "sampler.h"
+
+#include <stdlib.h>
+
+/** @brief Limits used when `sampler_init` receives no config. */
+static const SAMPLER_CONFIG_T default_config = {
+    .min_rate_hz = SAMPLER_MIN_RATE_HZ,
+    .max_rate_hz = SAMPLER_MAX_RATE_HZ,
+    .magnitude_threshold = SAMPLER_MAGNITUDE_THRESHOLD,
+    .velocity_threshold = SAMPLER_VELOCITY_THRESHOLD,
+};
+
+void sampler_init(SAMPLER_T *sampler, const SAMPLER_CONFIG_T *config)
+{
+    sampler->config = config ? *config : default_config;
+
+    if (sampler->config.min_rate_hz == 0)
+        sampler->config.min_rate_hz = 1;
+    if (sampler->config.max_rate_hz < sampler->config.min_rate_hz)
+        sampler->config.max_rate_hz = sampler->config.min_rate_hz;
+
+    sampler->min_period_us = 1000000u / sampler->config.max_rate_hz;
+    sampler->max_period_us = 1000000u / sampler->config.min_rate_hz;
+    sampler->period_us = sampler->max_period_us;
+    sampler->next_sample_us = 0;
+    sampler->last_x = 0;
+    sampler->last_y = 0;
+}
+
+bool sampler_due(SAMPLER_T *sampler, uint64_t now_us)
+{
+    if (now_us < sampler->next_sample_us)
+        return false;
+
+    sampler->next_sample_us += sampler->period_us;
+    if (sampler->next_sample_us <= now_us) // Fell behind (or first call): restart the grid.
+        sampler->next_sample_us = now_us + sampler->period_us;
+    return true;
+}
+
+void sampler_update(SAMPLER_T *sampler, const SENSOR_DATA_T *reading)
+{
+    uint32_t delta_x = abs(reading->analog_x - sampler->last_x);
+    uint32_t delta_y = abs(reading->analog_y - sampler->last_y);
+    uint32_t delta = delta_x > delta_y ? delta_x : delta_y;
+
+    sampler->last_x = reading->analog_x;
+    sampler->last_y = reading->analog_y;
+
+    // delta / period > threshold, kept in integers: delta * 1e6 > threshold * period_us.
+    bool moving = (uint64_t)delta * 1000000u > (uint64_t)sampler->config.velocity_threshold * sampler->period_us;
+    bool deflected = reading->magnitude > sampler->config.magnitude_threshold;
+
+    if (moving || deflected)
+    {
+        if (sampler->period_us != sampler->min_period_us)
+        {
+            // Pull the next reading in so the higher rate takes effect right away.
+            sampler->next_sample_us -= sampler->period_us - sampler->min_period_us;
+            sampler->period_us = sampler->min_period_us;
+        }
+        return;
+    }
+
+    uint32_t period = sampler->period_us + (sampler->period_us >> SAMPLER_DECAY_SHIFT);
+    sampler->period_us = period < sampler->max_period_us ? period : sampler->max_period_us;
+}
+
+uint64_t sampler_next_sample_us(const SAMPLER_T *sampler)
+{
+    return sampler->next_sample_us;
+}
+
+uint32_t sampler_rate_centihz(const SAMPLER_T *sampler)
+{
+    return 100000000u / sampler->period_us;
+}
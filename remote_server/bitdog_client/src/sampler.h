@@ -0,0 +1,90 @@
+/**
+ * @file sampler.h
+ * @brief Adaptive sampling scheduler driven by joystick activity.
+ *
+ * While the stick is deflected past a magnitude threshold, or moving faster
+ * than a velocity threshold, readings are taken at the maximum rate. Once it
+ * settles, the sampling period grows geometrically back to the idle rate.
+ */
+
+#ifndef SAMPLER_H
+#define SAMPLER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "readings.h"
+
+/** @brief Default idle sampling rate. */
+#define SAMPLER_MIN_RATE_HZ 1
+/** @brief Default sampling rate while the joystick is active. */
+#define SAMPLER_MAX_RATE_HZ 50
+/** @brief Default deflection that counts as activity (10% of full scale). */
+#define SAMPLER_MAGNITUDE_THRESHOLD 3277
+/** @brief Default axis speed that counts as activity (full scale units per second, 25%/s). */
+#define SAMPLER_VELOCITY_THRESHOLD 8192
+/** @brief Each idle sample stretches the period by 1/2^SAMPLER_DECAY_SHIFT. */
+#define SAMPLER_DECAY_SHIFT 3
+
+/**
+ * @brief Sampler limits and activity thresholds.
+ */
+typedef struct
+{
+    uint16_t min_rate_hz;         ///< Rate used when the joystick is idle.
+    uint16_t max_rate_hz;         ///< Rate used while the joystick is active.
+    uint16_t magnitude_threshold; ///< Deflection that counts as activity.
+    uint32_t velocity_threshold;  ///< Axis speed (units per second) that counts as activity.
+} SAMPLER_CONFIG_T;
+
+/**
+ * @brief Sampler state.
+ */
+typedef struct
+{
+    SAMPLER_CONFIG_T config; ///< Active limits.
+    uint32_t min_period_us;  ///< Period at `max_rate_hz`.
+    uint32_t max_period_us;  ///< Period at `min_rate_hz`.
+    uint32_t period_us;      ///< Current sampling period.
+    uint64_t next_sample_us; ///< When the next reading is due.
+    int16_t last_x;          ///< X of the previous reading (for the velocity estimate).
+    int16_t last_y;          ///< Y of the previous reading.
+} SAMPLER_T;
+
+/**
+ * @brief Initializes the sampler at the idle rate.
+ * @param sampler Sampler to initialize.
+ * @param config Limits, or NULL for the SAMPLER_* defaults.
+ */
+void sampler_init(SAMPLER_T *sampler, const SAMPLER_CONFIG_T *config);
+
+/**
+ * @brief Checks whether a reading is due and, if so, schedules the next one.
+ * @param sampler Sampler state.
+ * @param now_us Current time (`time_us_64()`).
+ * @return true if a reading should be taken now.
+ */
+bool sampler_due(SAMPLER_T *sampler, uint64_t now_us);
+
+/**
+ * @brief Adapts the sampling period to the activity seen in a new reading.
+ * @param sampler Sampler state.
+ * @param reading Reading just taken.
+ */
+void sampler_update(SAMPLER_T *sampler, const SENSOR_DATA_T *reading);
+
+/**
+ * @brief Time of the next reading, for sleeping until then.
+ * @param sampler Sampler state.
+ * @return Absolute time in microseconds.
+ */
+uint64_t sampler_next_sample_us(const SAMPLER_T *sampler);
+
+/**
+ * @brief Current sampling rate, for telemetry.
+ * @param sampler Sampler state.
+ * @return Rate in hundredths of Hz.
+ */
+uint32_t sampler_rate_centihz(const SAMPLER_T *sampler);
+
+#endif
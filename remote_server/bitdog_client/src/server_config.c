@@ -0,0 +1,105 @@
+#include "server_config.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "drivers/storage.h"
+
+static_assert(sizeof(SERVER_CONFIG_T) <= STORAGE_MAX_RECORD_SIZE, "server config must fit a storage record");
+
+/**
+ * @brief Checks a hostname: letters, digits, dots and hyphens (dotted addresses included).
+ */
+static bool server_config_host_is_valid(const char *host)
+{
+    size_t len = strnlen(host, SERVER_CONFIG_HOST_MAX);
+    if (len == 0 || len == SERVER_CONFIG_HOST_MAX)
+        return false;
+
+    for (size_t i = 0; i < len; ++i)
+    {
+        char c = host[i];
+        if (!((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '.' || c == '-'))
+            return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Checks a request path: starts with '/', no spaces or control characters.
+ */
+static bool server_config_path_is_valid(const char *path)
+{
+    size_t len = strnlen(path, SERVER_CONFIG_PATH_MAX);
+    if (len == 0 || len == SERVER_CONFIG_PATH_MAX || path[0] != '/')
+        return false;
+
+    for (size_t i = 0; i < len; ++i)
+        if (path[i] <= ' ' || path[i] == 0x7F)
+            return false;
+    return true;
+}
+
+static bool server_config_parse_port(const char *value, uint16_t *port)
+{
+    char *end;
+    unsigned long number = strtoul(value, &end, 10);
+    if (end == value || *end != '\0' || number == 0 || number > UINT16_MAX)
+        return false;
+    *port = (uint16_t)number;
+    return true;
+}
+
+bool server_config_load(SERVER_CONFIG_T *config)
+{
+    if (storage_load(STORAGE_SLOT_SERVER, config, sizeof(*config)) && config->version == SERVER_CONFIG_VERSION &&
+        server_config_host_is_valid(config->host) && server_config_path_is_valid(config->path) &&
+        config->http_port != 0 && config->udp_port != 0)
+        return true;
+
+    memset(config, 0, sizeof(*config));
+    config->version = SERVER_CONFIG_VERSION;
+    strcpy(config->host, SERVER_CONFIG_DEFAULT_HOST);
+    strcpy(config->path, SERVER_CONFIG_DEFAULT_PATH);
+    config->http_port = SERVER_CONFIG_DEFAULT_HTTP_PORT;
+    config->udp_port = SERVER_CONFIG_DEFAULT_UDP_PORT;
+    return false;
+}
+
+bool server_config_save(const SERVER_CONFIG_T *config)
+{
+    return storage_save(STORAGE_SLOT_SERVER, config, sizeof(*config));
+}
+
+bool server_config_set(SERVER_CONFIG_T *config, const char *key, const char *value)
+{
+    if (strcmp(key, "host") == 0)
+    {
+        if (strlen(value) >= SERVER_CONFIG_HOST_MAX || !server_config_host_is_valid(value))
+            return false;
+        memset(config->host, 0, sizeof(config->host));
+        strcpy(config->host, value);
+        return true;
+    }
+    if (strcmp(key, "path") == 0)
+    {
+        if (strlen(value) >= SERVER_CONFIG_PATH_MAX || !server_config_path_is_valid(value))
+            return false;
+        memset(config->path, 0, sizeof(config->path));
+        strcpy(config->path, value);
+        return true;
+    }
+    if (strcmp(key, "port") == 0)
+        return server_config_parse_port(value, &config->http_port);
+    if (strcmp(key, "udp") == 0)
+        return server_config_parse_port(value, &config->udp_port);
+    return false;
+}
+
+void server_config_print(const SERVER_CONFIG_T *config)
+{
+    printf("Servidor: host=%s porta=%u udp=%u caminho=%s\n", config->host, config->http_port, config->udp_port,
+           config->path);
+}
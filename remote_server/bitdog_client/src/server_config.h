@@ -0,0 +1,83 @@
+/**
+ * @file server_config.h
+ * @brief Readings server endpoint, kept in flash and changed at runtime.
+ *
+ * Holds the server hostname (or dotted address), its HTTP and UDP ports and
+ * the path the readings are posted to. The record lives in
+ * STORAGE_SLOT_SERVER; without a valid record the SERVER_CONFIG_DEFAULT_*
+ * values built into the firmware are used, so a fleet can be moved to a new
+ * collector from the serial console instead of being reflashed.
+ */
+
+#ifndef SERVER_CONFIG_H
+#define SERVER_CONFIG_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/** @brief Longest hostname, including the terminator. */
+#define SERVER_CONFIG_HOST_MAX 64
+/** @brief Longest request path, including the terminator. */
+#define SERVER_CONFIG_PATH_MAX 64
+/** @brief Layout version of the flash record. */
+#define SERVER_CONFIG_VERSION 1
+
+/** @brief Server used until one is provisioned (hostname or dotted address). */
+#ifndef SERVER_CONFIG_DEFAULT_HOST
+#define SERVER_CONFIG_DEFAULT_HOST "192.168.181.161"
+#endif
+/** @brief Default HTTP port. */
+#ifndef SERVER_CONFIG_DEFAULT_HTTP_PORT
+#define SERVER_CONFIG_DEFAULT_HTTP_PORT 5000
+#endif
+/** @brief Default UDP port of the datagram transport. */
+#ifndef SERVER_CONFIG_DEFAULT_UDP_PORT
+#define SERVER_CONFIG_DEFAULT_UDP_PORT 5005
+#endif
+/** @brief Default path of the readings POST. */
+#ifndef SERVER_CONFIG_DEFAULT_PATH
+#define SERVER_CONFIG_DEFAULT_PATH "/update_readings_bulk"
+#endif
+
+/**
+ * @brief Server endpoint (also the flash record).
+ */
+typedef struct
+{
+    uint8_t version;                   ///< SERVER_CONFIG_VERSION.
+    char host[SERVER_CONFIG_HOST_MAX]; ///< Hostname or dotted address.
+    char path[SERVER_CONFIG_PATH_MAX]; ///< Path of the readings POST.
+    uint16_t http_port;                ///< HTTP port.
+    uint16_t udp_port;                 ///< UDP port.
+} SERVER_CONFIG_T;
+
+/**
+ * @brief Loads the endpoint from flash, or the defaults if there is none.
+ * @param config Destination.
+ * @return true if a saved record was loaded.
+ */
+bool server_config_load(SERVER_CONFIG_T *config);
+
+/**
+ * @brief Saves the endpoint to flash.
+ * @param config Endpoint to save.
+ * @return true on success.
+ */
+bool server_config_save(const SERVER_CONFIG_T *config);
+
+/**
+ * @brief Changes one field after validating the value.
+ * @param config Endpoint to change.
+ * @param key `host`, `port`, `udp` or `path`.
+ * @param value New value.
+ * @return false if the key is unknown or the value is invalid (nothing changes).
+ */
+bool server_config_set(SERVER_CONFIG_T *config, const char *key, const char *value);
+
+/**
+ * @brief Prints the endpoint to stdout.
+ * @param config Endpoint to print.
+ */
+void server_config_print(const SERVER_CONFIG_T *config);
+
+#endif
@@ -0,0 +1,108 @@
+#include "udp_link.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "pico/stdlib.h"
+
+#include "lwip/pbuf.h"
+#include "lwip/udp.h"
+
+#include "drivers/storage.h"
+
+static uint8_t *put_u8(uint8_t *out, uint8_t value)
+{
+    *out++ = value;
+    return out;
+}
+
+static uint8_t *put_u16(uint8_t *out, uint16_t value)
+{
+    *out++ = (uint8_t)value;
+    *out++ = (uint8_t)(value >> 8);
+    return out;
+}
+
+static uint8_t *put_u32(uint8_t *out, uint32_t value)
+{
+    out = put_u16(out, (uint16_t)value);
+    return put_u16(out, (uint16_t)(value >> 16));
+}
+
+static uint8_t *put_u64(uint8_t *out, uint64_t value)
+{
+    out = put_u32(out, (uint32_t)value);
+    return put_u32(out, (uint32_t)(value >> 32));
+}
+
+bool udp_link_init(UDP_LINK_T *link)
+{
+    memset(link, 0, sizeof(*link));
+
+    link->pcb = udp_new_ip_type(IPADDR_TYPE_ANY);
+    if (!link->pcb)
+    {
+        printf("Erro ao criar PCB UDP\n");
+        return false;
+    }
+    return true;
+}
+
+void udp_link_set_server(UDP_LINK_T *link, const ip_addr_t *server_ip, uint16_t server_port)
+{
+    ip_addr_copy(link->server_ip, *server_ip);
+    link->server_port = server_port;
+    link->has_server = true;
+}
+
+bool udp_link_send(UDP_LINK_T *link, const BATCH_ENTRY_T *entries, uint8_t count, bool replay)
+{
+    if (!link->pcb || !link->has_server || count == 0 || count > UDP_LINK_MAX_ENTRIES)
+        return false;
+
+    uint16_t len = UDP_LINK_HEADER_SIZE + count * UDP_LINK_ENTRY_SIZE + sizeof(uint16_t);
+    struct pbuf *p = pbuf_alloc(PBUF_TRANSPORT, len, PBUF_RAM);
+    if (!p)
+    {
+        link->errors++;
+        return false;
+    }
+
+    // PBUF_RAM is one contiguous buffer: serialize straight into it
+    uint8_t *start = (uint8_t *)p->payload;
+    uint8_t *out = start;
+    out = put_u16(out, UDP_LINK_MAGIC);
+    out = put_u8(out, UDP_LINK_VERSION);
+    out = put_u8(out, replay ? UDP_LINK_FLAG_REPLAY : 0);
+    out = put_u32(out, link->sequence);
+    out = put_u64(out, time_us_64());
+    out = put_u16(out, count);
+
+    for (uint8_t i = 0; i < count; ++i)
+    {
+        const SENSOR_DATA_T *data = &entries[i].reading;
+        out = put_u64(out, entries[i].capture_us);
+        out = put_u16(out, (uint16_t)data->analog_x);
+        out = put_u16(out, (uint16_t)data->analog_y);
+        out = put_u16(out, data->heading);
+        out = put_u16(out, data->magnitude);
+        out = put_u16(out, (uint16_t)data->temperature);
+        out = put_u8(out, data->direction);
+        out = put_u8(out, (uint8_t)((data->button_a ? 0x01 : 0) | (data->button_b ? 0x02 : 0)));
+    }
+    put_u16(out, storage_crc16(start, out - start));
+
+    err_t err = udp_sendto(link->pcb, p, &link->server_ip, link->server_port);
+    pbuf_free(p);
+    if (err != ERR_OK)
+    {
+        link->errors++;
+        return false;
+    }
+
+    link->sequence++;
+    link->datagrams++;
+    link->readings += count;
+    link->bytes += len;
+    return true;
+}
@@ -0,0 +1,94 @@
+/**
+ * @file udp_link.h
+ * @brief Lightweight UDP publishing of readings.
+ *
+ * Each batch goes out as one datagram: no handshake, no acknowledgement and
+ * no retransmission. The datagram carries a sequence number, so the server
+ * can count losses, and a CRC-16 over the whole datagram. All fields are
+ * little-endian:
+ *
+ * | Offset | Size | Field                                          |
+ * |--------|------|------------------------------------------------|
+ * | 0      | 2    | magic (UDP_LINK_MAGIC)                         |
+ * | 2      | 1    | version (UDP_LINK_VERSION)                     |
+ * | 3      | 1    | flags (UDP_LINK_FLAG_*)                        |
+ * | 4      | 4    | sequence number (one per datagram, 0 at boot)  |
+ * | 8      | 8    | sent time (µs since boot)                      |
+ * | 16     | 2    | reading count                                  |
+ * | 18     | 20*n | readings (UDP_LINK_ENTRY_SIZE bytes each)      |
+ * | end-2  | 2    | CRC-16/CCITT of every byte before it           |
+ *
+ * Reading layout: capture time (u64, µs since boot), x (i16), y (i16), heading
+ * (u16, tenths of degree), magnitude (u16), temperature (i16, hundredths of
+ * °C), direction (u8), buttons (u8, bit 0 = A, bit 1 = B).
+ *
+ * There is no reply to measure the clock offset with, so the server estimates
+ * it from the smallest gap between the sent time and its own receive time.
+ */
+
+#ifndef UDP_LINK_H
+#define UDP_LINK_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "lwip/ip_addr.h"
+
+#include "batch.h"
+
+/** @brief First bytes of every datagram ("WR"). */
+#define UDP_LINK_MAGIC 0x5257
+/** @brief Datagram layout version. */
+#define UDP_LINK_VERSION 2
+/** @brief Flag: readings replayed from the flash log. */
+#define UDP_LINK_FLAG_REPLAY 0x01
+/** @brief Bytes before the readings. */
+#define UDP_LINK_HEADER_SIZE 18
+/** @brief Bytes per reading. */
+#define UDP_LINK_ENTRY_SIZE 20
+/** @brief Most readings in one datagram. */
+#define UDP_LINK_MAX_ENTRIES BATCH_CAPACITY
+
+/**
+ * @brief UDP publisher state and counters.
+ */
+typedef struct
+{
+    struct udp_pcb *pcb;  ///< Socket (NULL if it could not be created).
+    ip_addr_t server_ip;  ///< Server address.
+    uint16_t server_port; ///< Server UDP port.
+    bool has_server;      ///< `server_ip` and `server_port` are set.
+    uint32_t sequence;    ///< Sequence number of the next datagram.
+    uint32_t datagrams;   ///< Datagrams sent.
+    uint32_t readings;    ///< Readings sent.
+    uint32_t bytes;       ///< UDP payload bytes sent.
+    uint32_t errors;      ///< Datagrams lwIP could not allocate or send.
+} UDP_LINK_T;
+
+/**
+ * @brief Creates the socket.
+ * @param link Publisher to initialize.
+ * @return false if the socket could not be created.
+ */
+bool udp_link_init(UDP_LINK_T *link);
+
+/**
+ * @brief Sets the server the datagrams go to.
+ * @param link Publisher state.
+ * @param server_ip Server address.
+ * @param server_port Server UDP port.
+ */
+void udp_link_set_server(UDP_LINK_T *link, const ip_addr_t *server_ip, uint16_t server_port);
+
+/**
+ * @brief Sends readings as one datagram.
+ * @param link Publisher state.
+ * @param entries Readings, oldest first.
+ * @param count Number of readings (up to UDP_LINK_MAX_ENTRIES).
+ * @param replay Whether they come from the flash log.
+ * @return true if lwIP accepted the datagram (delivery is not confirmed); false
+ *         also while the server is not set.
+ */
+bool udp_link_send(UDP_LINK_T *link, const BATCH_ENTRY_T *entries, uint8_t count, bool replay);
+
+#endif
@@ -1,36 +1,463 @@
-from flask import Flask, Response, render_template, request
+import asyncio
+import binascii
+import struct
+import threading
+import time
+from collections import deque
+
+from flask import Flask, render_template, request
 
 app = Flask(__name__)
 
+# Datagram transport (see bitdog_client/src/udp_link.h for the layout).
+UDP_PORT = 5005
+UDP_MAGIC = 0x5257
+UDP_VERSION = 2
+UDP_FLAG_REPLAY = 0x01
+UDP_HEADER = struct.Struct("<HBBIQH")
+UDP_ENTRY = struct.Struct("<QhhHHhBB")
+JOYSTICK_FULL_SCALE = 32767
+
+# Capture-to-ingest latency tracking (see DeviceClock).
+LATENCY_WINDOW = 512  # Latest readings kept per device for the percentiles.
+CLOCK_SAMPLES = 8  # Latest clock samples; the one with the shortest round trip wins.
+PENDING_STAMPS = 32  # Stamped requests remembered until the device reports back.
+
+# Wind rose points in the same order as `wind_rose_dir_t` on the device.
+DIRECTIONS = (
+    "NORTE",
+    "NOR-NORDESTE",
+    "NORDESTE",
+    "LES-NORDESTE",
+    "LESTE",
+    "LES-SUDESTE",
+    "SUDESTE",
+    "SUL-SUDESTE",
+    "SUL",
+    "SUL-SUDOESTE",
+    "SUDOESTE",
+    "OES-SUDOESTE",
+    "OESTE",
+    "OES-NOROESTE",
+    "NOROESTE",
+    "NOR-NOROESTE",
+    "CENTRO",
+)
+
 last_reading = {
     "temp": 0.0,
     "joy_x": 0.0,
     "joy_y": 0.0,
+    "heading": 0.0,
+    "mag": 0.0,
+    "dir": DIRECTIONS[-1],
     "btn_a": 0,
     "btn_b": 0,
+    "published": 0,
+    "suppressed": 0,
+    "rate_hz": 0.0,
+    "connects": 0,
+    "reused": 0,
+    "per_request": 0.0,
+    "age_ms": 0,
+    "latency_p50_ms": 0.0,
+    "latency_p90_ms": 0.0,
+    "latency_p99_ms": 0.0,
+    "clock_source": "-",
+    "replayed": 0,
+    "udp_received": 0,
+    "udp_lost": 0,
+    "udp_late": 0,
+    "udp_invalid": 0,
+    "udp_loss_pct": 0.0,
 }
 
 
+def server_us():
+    return time.monotonic_ns() // 1000
+
+
+class DeviceClock:
+    """Clock offset and capture-to-ingest latency of one device.
+
+    Over HTTP the offset is measured NTP-style: the server notes when each
+    stamped request arrived (t2) and when it was answered (t3); in a later
+    request the device reports that stamp (t1) and when the response came
+    back (t4). Datagrams get no reply, so until such a sample exists the
+    smallest gap between a sent stamp and its receipt is used, which takes
+    the one-way delay as zero.
+    """
+
+    def __init__(self):
+        self.lock = threading.Lock()
+        self.latencies = deque(maxlen=LATENCY_WINDOW)
+        self.boot = None
+        self.restart()
+
+    def restart(self):
+        """Forgets the offset: the device rebooted and its clock started over."""
+        with self.lock:
+            self.pending = {}
+            self.samples = deque(maxlen=CLOCK_SAMPLES)
+            self.min_gap = None
+
+    def rebooted(self, boot):
+        """Whether an HTTP request carries a new boot id.
+
+        The stamps alone cannot tell: a retried request is older than the
+        ones that got through before it.
+        """
+        with self.lock:
+            rebooted = self.boot is not None and boot != self.boot
+            self.boot = boot
+            return rebooted
+
+    def received(self, sent_us, now_us):
+        """Notes a request or datagram stamped sent_us arriving at now_us."""
+        with self.lock:
+            if self.min_gap is None or now_us - sent_us < self.min_gap:
+                self.min_gap = now_us - sent_us
+
+    def answered(self, t1, t2, t3):
+        """Remembers the receive and reply times of the request stamped t1."""
+        with self.lock:
+            self.pending[t1] = (t2, t3)
+            if len(self.pending) > PENDING_STAMPS:
+                del self.pending[next(iter(self.pending))]
+
+    def sample(self, t1, t4):
+        """Completes the exchange of the request stamped t1."""
+        with self.lock:
+            times = self.pending.pop(t1, None)
+            if times is None:
+                return
+            t2, t3 = times
+            round_trip = (t4 - t1) - (t3 - t2)
+            self.samples.append((round_trip, ((t2 - t1) + (t3 - t4)) // 2))
+
+    def offset(self):
+        """Server time minus device time, and how it was obtained."""
+        if self.samples:
+            return min(self.samples)[1], "ntp"
+        return self.min_gap, "one-way"
+
+    def record(self, readings, now_us):
+        """Adds the latency of live readings ingested at now_us."""
+        with self.lock:
+            offset, _ = self.offset()
+            if offset is None:
+                return
+            for reading in readings:
+                self.latencies.append(now_us - (reading["t_us"] + offset))
+
+    def stats(self):
+        with self.lock:
+            ordered = sorted(self.latencies)
+            offset, source = self.offset()
+            round_trip = min(self.samples)[0] if self.samples else None
+        if not ordered:
+            return None
+
+        def percentile(q):
+            return round(
+                ordered[min(int(q * len(ordered)), len(ordered) - 1)] / 1000, 2
+            )
+
+        return {
+            "count": len(ordered),
+            "p50_ms": percentile(0.50),
+            "p90_ms": percentile(0.90),
+            "p99_ms": percentile(0.99),
+            "max_ms": round(ordered[-1] / 1000, 2),
+            "clock_source": source,
+            "clock_offset_us": offset,
+            "round_trip_us": round_trip,
+        }
+
+
+# One clock per device, keyed by its address.
+device_clocks = {}
+device_clocks_lock = threading.Lock()
+
+
+def device_clock(address):
+    with device_clocks_lock:
+        return device_clocks.setdefault(address, DeviceClock())
+
+
+def apply_latency(clock):
+    stats = clock.stats()
+    if stats:
+        last_reading["latency_p50_ms"] = stats["p50_ms"]
+        last_reading["latency_p90_ms"] = stats["p90_ms"]
+        last_reading["latency_p99_ms"] = stats["p99_ms"]
+        last_reading["clock_source"] = stats["clock_source"]
+
+
+def direction_name(direction_id):
+    if isinstance(direction_id, int) and 0 <= direction_id < len(DIRECTIONS):
+        return DIRECTIONS[direction_id]
+    return DIRECTIONS[-1]
+
+
 @app.get("/")
 def home():
     return render_template("index.html", **last_reading)
 
 
+def is_int(value):
+    # JSON true/false arrive as bool, which Python counts as int.
+    return isinstance(value, int) and not isinstance(value, bool)
+
+
+def valid_stamps(sensors_data, readings):
+    """Whether the stamps the device clock is worked out from are well formed.
+
+    A malformed request gets a 400, which the device takes as final; a 500
+    from a KeyError would make it send the same request again.
+    """
+    clock = sensors_data.get("clock")
+    if clock is not None and not (
+        isinstance(clock, dict) and is_int(clock.get("t1")) and is_int(clock.get("t4"))
+    ):
+        return False
+    sent_us = sensors_data.get("sent_us")
+    if sent_us is not None and not is_int(sent_us):
+        return False
+    return all(
+        isinstance(reading, dict) and is_int(reading.get("t_us"))
+        for reading in readings
+    )
+
+
+# Fields of a reading as the device sends them.
+READING_FIELDS = ("temp", "joy_x", "joy_y", "heading", "mag", "dir", "btn_a", "btn_b")
+
+
+def valid_reading(reading):
+    """Whether a reading has every field apply_reading() needs, as a number."""
+    return isinstance(reading, dict) and all(
+        isinstance(reading.get(field), (int, float)) for field in READING_FIELDS
+    )
+
+
+def apply_reading(reading):
+    last_reading["temp"] = reading["temp"]
+    last_reading["joy_x"] = reading["joy_x"]
+    last_reading["joy_y"] = reading["joy_y"]
+    last_reading["heading"] = reading["heading"]
+    last_reading["mag"] = reading["mag"]
+    last_reading["dir"] = direction_name(reading["dir"])
+    last_reading["btn_a"] = reading["btn_a"]
+    last_reading["btn_b"] = reading["btn_b"]
+
+
+def apply_counters(sensors_data):
+    # Change-driven publishing counters: how many readings the device skipped.
+    last_reading["published"] = sensors_data.get("published", 0)
+    last_reading["suppressed"] = sensors_data.get("suppressed", 0)
+    last_reading["rate_hz"] = sensors_data.get("rate_hz", 0.0)
+    # Keep-alive counters: handshakes done vs. requests that reused the connection.
+    last_reading["connects"] = sensors_data.get("connects", 0)
+    last_reading["reused"] = sensors_data.get("reused", 0)
+
+
+@app.get("/latency")
+def latency():
+    with device_clocks_lock:
+        clocks = dict(device_clocks)
+    return {address: clock.stats() for address, clock in clocks.items()}
+
+
 @app.post("/update_readings")
 def update_readings():
     if not request.json:
-        return Response({"detail": "Invalid Request"}, status=400)
+        return {"detail": "Invalid Request"}, 400
 
     sensors_data = request.json
+    if not valid_reading(sensors_data):
+        return {"detail": "Invalid Request"}, 400
+
+    apply_reading(sensors_data)
+    apply_counters(sensors_data)
+
+    return {"detail": "Sensor data recieved"}, 200
+
+
+@app.post("/update_readings_bulk")
+def update_readings_bulk():
+    # Replies are JSON with a Content-Length: the device parses the status and
+    # framing of every response on the keep-alive connection (4xx is final, 5xx
+    # is retried).
+    received_us = server_us()
+    sensors_data = request.get_json(silent=True)
+    if not sensors_data or not sensors_data.get("readings"):
+        return {"detail": "Invalid Request"}, 400
+
+    readings = sensors_data["readings"]
+    # Every reading is checked before any is applied: a 400 is final on the
+    # device, so the batch is not applied in part and then sent again.
+    if not isinstance(readings, list) or not valid_stamps(sensors_data, readings):
+        return {"detail": "Invalid Request"}, 400
+    if not all(valid_reading(reading) for reading in readings):
+        return {"detail": "Invalid Request"}, 400
+    apply_counters(sensors_data)
+
+    clock = device_clock(request.remote_addr)
+    if clock.rebooted(sensors_data.get("boot")):
+        clock.restart()
+    sent_us = sensors_data.get("sent_us")
+    if sent_us is not None:
+        clock.received(sent_us, received_us)
+    if "clock" in sensors_data:
+        clock.sample(sensors_data["clock"]["t1"], sensors_data["clock"]["t4"])
+    response = handle_bulk(sensors_data, readings, clock, received_us)
+    if sent_us is not None:
+        clock.answered(sent_us, received_us, server_us())
+    return response
+
+
+def handle_bulk(sensors_data, readings, clock, received_us):
+    """Applies the readings of a bulk post and returns the reply."""
+    # Readings replayed from the device flash log are older than the live
+    # state, so they are only counted.
+    if sensors_data.get("replay"):
+        last_reading["replayed"] += len(readings)
+        return {"detail": f"{len(readings)} readings replayed"}, 200
+
+    # Readings arrive oldest first; the last one is the current state.
+    for reading in readings:
+        apply_reading(reading)
+    clock.record(readings, received_us)
+    apply_latency(clock)
+
+    # Effective readings per request (device average) and how long the newest one waited.
+    last_reading["per_request"] = sensors_data.get("per_request", float(len(readings)))
+    last_reading["age_ms"] = (
+        sensors_data.get("sent_us", 0) - readings[-1].get("t_us", 0)
+    ) // 1000
+
+    return {"detail": f"{len(readings)} readings recieved"}, 200
+
+
+def decode_datagram(data):
+    """Returns (sequence, flags, sent_us, readings) or None if the datagram is malformed."""
+    if len(data) < UDP_HEADER.size + 2:
+        return None
+    if (
+        binascii.crc_hqx(data[:-2], 0xFFFF)
+        != struct.unpack_from("<H", data, len(data) - 2)[0]
+    ):
+        return None
+
+    magic, version, flags, sequence, sent_us, count = UDP_HEADER.unpack_from(data)
+    if magic != UDP_MAGIC or version != UDP_VERSION:
+        return None
+    if len(data) != UDP_HEADER.size + count * UDP_ENTRY.size + 2:
+        return None
+
+    readings = []
+    for i in range(count):
+        t_us, x, y, heading, mag, temp, direction, buttons = UDP_ENTRY.unpack_from(
+            data, UDP_HEADER.size + i * UDP_ENTRY.size
+        )
+        readings.append(
+            {
+                "t_us": t_us,
+                "temp": temp / 100,
+                "joy_x": round(x / JOYSTICK_FULL_SCALE, 2),
+                "joy_y": round(y / JOYSTICK_FULL_SCALE, 2),
+                "heading": heading / 10,
+                "mag": round(mag / JOYSTICK_FULL_SCALE, 2),
+                "dir": direction,
+                "btn_a": buttons & 0x01,
+                "btn_b": (buttons >> 1) & 0x01,
+            }
+        )
+    return sequence, flags, sent_us, readings
+
+
+class UdpSender:
+    """Sequence numbers and loss counters of one device's datagrams."""
+
+    def __init__(self):
+        self.expected = None
+        self.received = 0
+        self.lost = 0
+        self.late = 0
+
+    def track(self, sequence):
+        """Counts a datagram; returns whether it arrived after a newer one."""
+        self.received += 1
+        if self.expected is None or sequence == 0:
+            # First datagram heard from this device or it rebooted.
+            self.expected = sequence + 1
+        elif sequence >= self.expected:
+            self.lost += sequence - self.expected
+            self.expected = sequence + 1
+        else:
+            # Arrived after a newer one: it was counted as lost.
+            self.late += 1
+            self.lost = max(self.lost - 1, 0)
+            return True
+        return False
+
+
+class UdpReadingsProtocol(asyncio.DatagramProtocol):
+    """Applies datagram readings and counts losses from the sequence numbers."""
+
+    def __init__(self):
+        # One sequence per device, keyed by its address like the clocks.
+        self.senders = {}
+
+    def datagram_received(self, data, addr):
+        received_us = server_us()
+        decoded = decode_datagram(data)
+        if decoded is None:
+            last_reading["udp_invalid"] += 1
+            return
+
+        sequence, flags, sent_us, readings = decoded
+        sender = self.senders.setdefault(addr[0], UdpSender())
+        clock = device_clock(addr[0])
+
+        if sequence == 0 or sender.expected is None:
+            clock.restart()
+        if sender.track(sequence):
+            flags |= UDP_FLAG_REPLAY  # Its readings are stale.
+        self.apply_totals()
+
+        clock.received(sent_us, received_us)
+
+        if flags & UDP_FLAG_REPLAY:
+            last_reading["replayed"] += len(readings)
+            return
+        for reading in readings:
+            apply_reading(reading)
+        clock.record(readings, received_us)
+        apply_latency(clock)
+
+    def apply_totals(self):
+        senders = self.senders.values()
+        last_reading["udp_received"] = sum(sender.received for sender in senders)
+        last_reading["udp_lost"] = sum(sender.lost for sender in senders)
+        last_reading["udp_late"] = sum(sender.late for sender in senders)
+        total = last_reading["udp_received"] + last_reading["udp_lost"]
+        last_reading["udp_loss_pct"] = round(100 * last_reading["udp_lost"] / total, 2)
+
+
+async def serve_udp():
+    loop = asyncio.get_running_loop()
+    await loop.create_datagram_endpoint(
+        UdpReadingsProtocol, local_addr=("0.0.0.0", UDP_PORT)
+    )
+    await asyncio.Event().wait()
 
-    last_reading["temp"] = sensors_data["temp"]
-    last_reading["joy_x"] = sensors_data["joy_x"]
-    last_reading["joy_y"] = sensors_data["joy_y"]
-    last_reading["btn_a"] = sensors_data["btn_a"]
-    last_reading["btn_b"] = sensors_data["btn_b"]
 
-    return Response({"detail": "Sensor data recieved"}, status=200)
+def start_udp_listener():
+    threading.Thread(target=asyncio.run, args=(serve_udp(),), daemon=True).start()
 
 
 if __name__ == "__main__":
+    start_udp_listener()
     app.run("0.0.0.0")
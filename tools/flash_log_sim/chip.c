@@ -0,0 +1,75 @@
+/**
+ * @file chip.c
+ * @brief Flash NOR simulada e as rotinas do SDK que o log usa para gravá-la.
+ */
+
+#include "chip.h"
+
+#include <assert.h>
+#include <string.h>
+
+#include "hardware/flash.h"
+#include "pico/flash.h"
+
+uint8_t chip_memory[PICO_FLASH_SIZE_BYTES];
+
+static uint32_t sector_erases[PICO_FLASH_SIZE_BYTES / FLASH_SECTOR_SIZE];
+static bool fail_next;
+static size_t cut_bytes = SIZE_MAX;
+
+void chip_reset(void)
+{
+    memset(chip_memory, 0xFF, sizeof(chip_memory));
+    memset(sector_erases, 0, sizeof(sector_erases));
+    fail_next = false;
+    cut_bytes = SIZE_MAX;
+}
+
+uint32_t chip_sector_erases(uint32_t sector)
+{
+    return sector_erases[sector];
+}
+
+void chip_fail_next(void)
+{
+    fail_next = true;
+}
+
+void chip_cut_next_program(size_t bytes)
+{
+    cut_bytes = bytes;
+}
+
+void flash_range_erase(uint32_t flash_offs, size_t count)
+{
+    assert(flash_offs % FLASH_SECTOR_SIZE == 0 && count % FLASH_SECTOR_SIZE == 0);
+    assert(flash_offs + count <= sizeof(chip_memory));
+
+    memset(chip_memory + flash_offs, 0xFF, count);
+    for (size_t i = 0; i < count / FLASH_SECTOR_SIZE; ++i)
+        sector_erases[flash_offs / FLASH_SECTOR_SIZE + i]++;
+}
+
+void flash_range_program(uint32_t flash_offs, const uint8_t *data, size_t count)
+{
+    assert(flash_offs % FLASH_PAGE_SIZE == 0 && count % FLASH_PAGE_SIZE == 0);
+    assert(flash_offs + count <= sizeof(chip_memory));
+
+    if (cut_bytes < count)
+        count = cut_bytes;
+    cut_bytes = SIZE_MAX;
+
+    for (size_t i = 0; i < count; ++i)
+        chip_memory[flash_offs + i] &= data[i]; // Programar não volta bits a 1
+}
+
+int flash_safe_execute(void (*func)(void *), void *param, uint32_t enter_exit_timeout_ms)
+{
+    if (fail_next)
+    {
+        fail_next = false;
+        return PICO_ERROR_TIMEOUT;
+    }
+    func(param);
+    return PICO_OK;
+}
@@ -0,0 +1,36 @@
+/**
+ * @file chip.h
+ * @brief Flash NOR simulada: apagar leva um setor inteiro a 0xFF e programar só
+ *        limpa bits, como no chip da placa.
+ *
+ * Também simula as falhas que o log precisa tolerar: a trava da flash que não
+ * é obtida a tempo e a queda de energia no meio de uma gravação.
+ */
+
+#ifndef CHIP_H
+#define CHIP_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Apaga o chip inteiro e zera os contadores.
+ */
+void chip_reset(void);
+
+/**
+ * @brief Quantas vezes o setor foi apagado desde chip_reset().
+ */
+uint32_t chip_sector_erases(uint32_t sector);
+
+/**
+ * @brief Faz a próxima chamada de flash_safe_execute falhar sem tocar na flash.
+ */
+void chip_fail_next(void);
+
+/**
+ * @brief Corta a energia na próxima programação: só os primeiros `bytes` chegam à flash.
+ */
+void chip_cut_next_program(size_t bytes);
+
+#endif
@@ -0,0 +1,20 @@
+/**
+ * @file flash.h
+ * @brief Flash NOR simulada (chip.c): a janela XIP aponta para a memória do chip.
+ */
+
+#ifndef SIM_HARDWARE_FLASH_H
+#define SIM_HARDWARE_FLASH_H
+
+#include "pico/stdlib.h"
+
+#define FLASH_PAGE_SIZE (1u << 8)
+#define FLASH_SECTOR_SIZE (1u << 12)
+
+extern uint8_t chip_memory[PICO_FLASH_SIZE_BYTES];
+#define XIP_BASE ((uintptr_t)chip_memory)
+
+void flash_range_erase(uint32_t flash_offs, size_t count);
+void flash_range_program(uint32_t flash_offs, const uint8_t *data, size_t count);
+
+#endif
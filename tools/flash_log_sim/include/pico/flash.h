@@ -0,0 +1,13 @@
+/**
+ * @file flash.h
+ * @brief flash_safe_execute falso: roda a operação na hora, ou falha quando o teste pede (chip.c).
+ */
+
+#ifndef SIM_PICO_FLASH_H
+#define SIM_PICO_FLASH_H
+
+#include "pico/stdlib.h"
+
+int flash_safe_execute(void (*func)(void *), void *param, uint32_t enter_exit_timeout_ms);
+
+#endif
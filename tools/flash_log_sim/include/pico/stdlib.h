@@ -0,0 +1,20 @@
+/**
+ * @file stdlib.h
+ * @brief Subconjunto do pico/stdlib.h usado pelo log na flash, para compilação no host.
+ */
+
+#ifndef SIM_PICO_STDLIB_H
+#define SIM_PICO_STDLIB_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define PICO_OK 0
+#define PICO_ERROR_GENERIC -1
+#define PICO_ERROR_TIMEOUT -2
+
+/// Tamanho da flash da Pico W
+#define PICO_FLASH_SIZE_BYTES (2 * 1024 * 1024)
+
+#endif
@@ -0,0 +1,378 @@
+/**
+ * @file sim.c
+ * @brief Testes do log na flash (flash_log.c) no host, sobre a flash simulada de chip.c.
+ *
+ * Uso: flash_log_sim
+ *
+ * Cada cenário grava leituras numeradas em sequência (o número vai em
+ * `capture_us`), reenvia as páginas e confere a ordem, os contadores e o estado
+ * reconstruído por flash_log_init() depois de um reinício simulado.
+ *
+ * Retorna 1 se algum cenário falhar.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "chip.h"
+#include "flash_log.h"
+#include "storage.h"
+
+/// Quantidade de páginas gravadas no cenário de transbordo (mais que o anel comporta)
+#define SIM_OVERFILL_PAGES 600
+
+/// Voltas completas do anel no cenário de desgaste
+#define SIM_WEAR_LAPS 20
+
+/// Setor da flash onde o log começa
+#define SIM_FIRST_SECTOR ((PICO_FLASH_SIZE_BYTES - STORAGE_RESERVED_BYTES) / FLASH_SECTOR_SIZE - FLASH_LOG_SECTORS)
+
+static int failures = 0;
+
+/// Número da próxima leitura gravada
+static uint64_t next_written;
+
+#define CHECK(cond, ...)                                                                                               \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        if (!(cond))                                                                                                   \
+        {                                                                                                              \
+            printf("  FALHA (%s:%d): ", __FILE__, __LINE__);                                                           \
+            printf(__VA_ARGS__);                                                                                       \
+            printf("\n");                                                                                              \
+            failures++;                                                                                                \
+        }                                                                                                              \
+    } while (0)
+
+/**
+ * @brief Flash apagada e log vazio, como numa placa nova.
+ */
+static void start(const char *name, FLASH_LOG_T *log)
+{
+    printf("%s\n", name);
+    chip_reset();
+    next_written = 0;
+    flash_log_init(log);
+}
+
+/**
+ * @brief Grava `count` leituras numeradas a partir de next_written.
+ */
+static bool append(FLASH_LOG_T *log, uint32_t count)
+{
+    BATCH_ENTRY_T entries[FLASH_LOG_PAGE_ENTRIES * 4];
+    while (count > 0)
+    {
+        uint32_t n = count < sizeof(entries) / sizeof(entries[0]) ? count : sizeof(entries) / sizeof(entries[0]);
+        memset(entries, 0, sizeof(entries));
+        for (uint32_t i = 0; i < n; ++i)
+        {
+            entries[i].capture_us = next_written + i;
+            entries[i].reading.temperature = (int16_t)(next_written + i); // Varia o CRC de página para página
+        }
+        if (!flash_log_append(log, entries, (uint8_t)n))
+            return false;
+        next_written += n;
+        count -= n;
+    }
+    return true;
+}
+
+/**
+ * @brief Reenvia até `pages` páginas e confere que as leituras seguem a partir de `*expected`.
+ * @return Leituras reenviadas.
+ */
+static uint32_t drain(FLASH_LOG_T *log, uint32_t pages, uint64_t *expected)
+{
+    uint32_t drained = 0;
+    uint8_t count;
+    uint32_t sequence;
+    const BATCH_ENTRY_T *entries;
+    while (pages-- > 0 && (entries = flash_log_replay(log, &count, &sequence)))
+    {
+        for (uint8_t i = 0; i < count; ++i)
+        {
+            if (entries[i].capture_us != *expected)
+            {
+                CHECK(false, "leitura %llu fora de ordem (esperada %llu)", (unsigned long long)entries[i].capture_us,
+                      (unsigned long long)*expected);
+                *expected = entries[i].capture_us;
+            }
+            ++*expected;
+        }
+        drained += count;
+        CHECK(flash_log_consume(log, sequence), "flash_log_consume falhou");
+    }
+    return drained;
+}
+
+/**
+ * @brief Simula um reinício e confere que o estado reconstruído da flash é o mesmo.
+ */
+static void reboot(FLASH_LOG_T *log)
+{
+    FLASH_LOG_T rebuilt;
+    flash_log_init(&rebuilt);
+    CHECK(rebuilt.head == log->head, "head %u depois do reinício (era %u)", rebuilt.head, log->head);
+    CHECK(rebuilt.tail == log->tail || log->pending == 0, "tail %u depois do reinício (era %u)", rebuilt.tail,
+          log->tail);
+    CHECK(rebuilt.pending == log->pending, "pending %u depois do reinício (era %u)", rebuilt.pending, log->pending);
+    CHECK(rebuilt.sequence == log->sequence, "sequence %lu depois do reinício (era %lu)",
+          (unsigned long)rebuilt.sequence, (unsigned long)log->sequence);
+    *log = rebuilt;
+}
+
+/**
+ * @brief Poucas páginas: tudo volta na ordem, e uma página parcial ocupa uma página inteira.
+ */
+static void scenario_order(void)
+{
+    FLASH_LOG_T log;
+    start("ordem", &log);
+    CHECK(flash_log_empty(&log), "log novo não está vazio");
+
+    CHECK(append(&log, 2 * FLASH_LOG_PAGE_ENTRIES + 3), "append falhou");
+    CHECK(log.pending == 3, "pending %u (esperado 3)", log.pending);
+
+    uint64_t expected = 0;
+    uint32_t drained = drain(&log, UINT32_MAX, &expected);
+    CHECK(drained == next_written, "%lu leituras reenviadas de %llu", (unsigned long)drained,
+          (unsigned long long)next_written);
+    CHECK(flash_log_empty(&log), "log não esvaziou");
+    CHECK(log.written == drained && log.drained == drained && log.dropped == 0, "contadores %lu/%lu/%lu",
+          (unsigned long)log.written, (unsigned long)log.drained, (unsigned long)log.dropped);
+}
+
+/**
+ * @brief Reinício no meio do reenvio: continua da primeira página não enviada.
+ */
+static void scenario_reboot(void)
+{
+    FLASH_LOG_T log;
+    start("reinicio", &log);
+    CHECK(append(&log, 20 * FLASH_LOG_PAGE_ENTRIES), "append falhou");
+
+    uint64_t expected = 0;
+    drain(&log, 7, &expected);
+    reboot(&log);
+    CHECK(log.pending == 13, "pending %u depois do reinício (esperado 13)", log.pending);
+
+    CHECK(append(&log, FLASH_LOG_PAGE_ENTRIES), "append depois do reinício falhou");
+    drain(&log, UINT32_MAX, &expected);
+    CHECK(expected == next_written, "reenvio parou na leitura %llu de %llu", (unsigned long long)expected,
+          (unsigned long long)next_written);
+}
+
+/**
+ * @brief 600 páginas num anel de 512: os setores mais antigos são apagados e contados
+ *        como perdidos, e o reenvio começa na página mais antiga que sobrou.
+ */
+static void scenario_overfill(void)
+{
+    FLASH_LOG_T log;
+    start("transbordo", &log);
+    CHECK(append(&log, SIM_OVERFILL_PAGES * FLASH_LOG_PAGE_ENTRIES), "append falhou");
+
+    // Cada setor em que o escritor entra de novo perde as suas páginas inteiras
+    uint32_t pages_per_sector = FLASH_SECTOR_SIZE / FLASH_PAGE_SIZE;
+    uint32_t wrapped = SIM_OVERFILL_PAGES - FLASH_LOG_PAGES;
+    uint32_t lost_pages = (wrapped + pages_per_sector - 1) / pages_per_sector * pages_per_sector;
+    printf("  %u páginas gravadas em %u, %lu páginas perdidas\n", SIM_OVERFILL_PAGES, FLASH_LOG_PAGES,
+           (unsigned long)lost_pages);
+
+    CHECK(log.pending == SIM_OVERFILL_PAGES - lost_pages, "pending %u (esperado %lu)", log.pending,
+          (unsigned long)(SIM_OVERFILL_PAGES - lost_pages));
+    CHECK(log.dropped == lost_pages * FLASH_LOG_PAGE_ENTRIES, "dropped %lu (esperado %lu)", (unsigned long)log.dropped,
+          (unsigned long)(lost_pages * FLASH_LOG_PAGE_ENTRIES));
+    CHECK(log.head == SIM_OVERFILL_PAGES % FLASH_LOG_PAGES, "head %u (esperado %u)", log.head,
+          SIM_OVERFILL_PAGES % FLASH_LOG_PAGES);
+    CHECK(log.tail == lost_pages % FLASH_LOG_PAGES, "tail %u (esperado %lu)", log.tail,
+          (unsigned long)(lost_pages % FLASH_LOG_PAGES));
+
+    reboot(&log);
+
+    uint64_t expected = (uint64_t)lost_pages * FLASH_LOG_PAGE_ENTRIES;
+    uint32_t drained = drain(&log, UINT32_MAX, &expected);
+    CHECK(expected == next_written, "reenvio parou na leitura %llu de %llu", (unsigned long long)expected,
+          (unsigned long long)next_written);
+    CHECK(drained == (SIM_OVERFILL_PAGES - lost_pages) * FLASH_LOG_PAGE_ENTRIES, "%lu leituras reenviadas",
+          (unsigned long)drained);
+    CHECK(flash_log_empty(&log), "log não esvaziou");
+}
+
+/**
+ * @brief Várias voltas gravando e reenviando: todos os setores são apagados o mesmo número de vezes.
+ */
+static void scenario_wear(void)
+{
+    FLASH_LOG_T log;
+    start("desgaste", &log);
+
+    uint64_t expected = 0;
+    for (uint32_t i = 0; i < SIM_WEAR_LAPS * FLASH_LOG_PAGES; ++i)
+    {
+        CHECK(append(&log, FLASH_LOG_PAGE_ENTRIES), "append falhou");
+        if (i % 3 != 0) // O reenvio fica um pouco atrás da gravação
+            drain(&log, 2, &expected);
+    }
+    drain(&log, UINT32_MAX, &expected);
+    CHECK(log.dropped == 0, "dropped %lu sem o log encher", (unsigned long)log.dropped);
+    CHECK(expected == next_written, "reenvio parou na leitura %llu de %llu", (unsigned long long)expected,
+          (unsigned long long)next_written);
+
+    uint32_t min = UINT32_MAX, max = 0;
+    for (uint32_t s = 0; s < FLASH_LOG_SECTORS; ++s)
+    {
+        uint32_t erases = chip_sector_erases(SIM_FIRST_SECTOR + s);
+        min = erases < min ? erases : min;
+        max = erases > max ? erases : max;
+    }
+    printf("  %u voltas: cada setor apagado entre %lu e %lu vezes\n", SIM_WEAR_LAPS, (unsigned long)min,
+           (unsigned long)max);
+    CHECK(max - min <= 1, "desgaste desigual: %lu a %lu apagamentos", (unsigned long)min, (unsigned long)max);
+    CHECK(chip_sector_erases(SIM_FIRST_SECTOR - 1) == 0 &&
+              chip_sector_erases(SIM_FIRST_SECTOR + FLASH_LOG_SECTORS) == 0,
+          "setor fora do log apagado");
+}
+
+/**
+ * @brief Queda de energia no meio de uma página: ela é ignorada no reinício e pulada na gravação seguinte.
+ */
+static void scenario_torn_page(void)
+{
+    FLASH_LOG_T log;
+    start("pagina_rasgada", &log);
+    CHECK(append(&log, 3 * FLASH_LOG_PAGE_ENTRIES), "append falhou");
+
+    uint16_t torn = log.head;
+    chip_cut_next_program(FLASH_LOG_PAGE_HEADER_SIZE + 8); // Cabeçalho gravado, leituras pela metade
+    append(&log, FLASH_LOG_PAGE_ENTRIES);
+    uint64_t lost_first = next_written - FLASH_LOG_PAGE_ENTRIES;
+
+    FLASH_LOG_T rebuilt;
+    flash_log_init(&rebuilt);
+    CHECK(rebuilt.pending == 3, "pending %u depois do reinício (esperado 3)", rebuilt.pending);
+    CHECK(rebuilt.head == torn, "head %u depois do reinício (esperado %u)", rebuilt.head, torn);
+    log = rebuilt;
+
+    CHECK(append(&log, FLASH_LOG_PAGE_ENTRIES), "append depois do reinício falhou");
+    CHECK(log.head == (uint16_t)(torn + 2), "a página rasgada não foi pulada (head %u)", log.head);
+
+    uint64_t expected = 0;
+    drain(&log, 3, &expected);
+    CHECK(expected == lost_first, "reenvio parou na leitura %llu (esperada %llu)", (unsigned long long)expected,
+          (unsigned long long)lost_first);
+    expected = lost_first + FLASH_LOG_PAGE_ENTRIES; // As leituras da página rasgada se perderam
+    drain(&log, UINT32_MAX, &expected);
+    CHECK(expected == next_written && flash_log_empty(&log), "reenvio parou na leitura %llu de %llu",
+          (unsigned long long)expected, (unsigned long long)next_written);
+}
+
+/**
+ * @brief Entrega a próxima página e confere o número de sequência dela.
+ */
+static void expect_replay(FLASH_LOG_T *log, uint32_t expected, int line)
+{
+    uint8_t count;
+    uint32_t sequence = UINT32_MAX;
+    if (!flash_log_replay(log, &count, &sequence) || sequence != expected)
+    {
+        printf("  FALHA (linha %d): página %ld entregue, esperada %lu\n", line,
+               sequence == UINT32_MAX ? -1L : (long)sequence, (unsigned long)expected);
+        failures++;
+    }
+}
+#define EXPECT_REPLAY(log, expected) expect_replay(log, expected, __LINE__)
+
+/**
+ * @brief Páginas em voo: ficam na flash até a resposta, que pode vir fora de
+ *        ordem, e voltam depois de um reinício, de um rewind ou se o anel
+ *        der a volta sobre elas.
+ */
+static void scenario_in_flight(void)
+{
+    FLASH_LOG_T log;
+    start("em_voo", &log);
+    CHECK(append(&log, 6 * FLASH_LOG_PAGE_ENTRIES), "append falhou");
+
+    for (uint32_t i = 0; i < 6; ++i)
+        EXPECT_REPLAY(&log, i);
+    uint8_t count;
+    uint32_t sequence;
+    CHECK(!flash_log_waiting(&log) && !flash_log_replay(&log, &count, &sequence),
+          "página entregue duas vezes sem rewind");
+    CHECK(log.pending == 6 && !flash_log_empty(&log), "páginas em voo contadas como enviadas");
+
+    CHECK(flash_log_consume(&log, 1) && log.tail == 0, "resposta fora de ordem: tail %u", log.tail);
+    CHECK(flash_log_consume(&log, 0) && log.tail == 2, "tail %u depois das páginas 0 e 1 (esperado 2)", log.tail);
+    CHECK(!flash_log_consume(&log, 1) && !flash_log_consume(&log, 9), "consumiu uma página já enviada ou ausente");
+    CHECK(log.pending == 4 && log.drained == 2 * FLASH_LOG_PAGE_ENTRIES, "pending %u drained %lu", log.pending,
+          (unsigned long)log.drained);
+
+    // Reinício com as páginas 2 a 5 em voo: voltam todas, na ordem
+    reboot(&log);
+    CHECK(flash_log_waiting(&log), "páginas em voo antes do reinício não voltaram");
+    EXPECT_REPLAY(&log, 2);
+    EXPECT_REPLAY(&log, 3);
+    CHECK(flash_log_consume(&log, 3), "consume falhou");
+    flash_log_rewind(&log);
+    EXPECT_REPLAY(&log, 2);
+    EXPECT_REPLAY(&log, 4);
+
+    // O escritor volta ao setor das páginas em voo e passa da posição do reenvio: elas se perdem e o
+    // reenvio segue na mais antiga que sobrou
+    uint32_t pages_per_sector = FLASH_SECTOR_SIZE / FLASH_PAGE_SIZE;
+    CHECK(append(&log, (FLASH_LOG_PAGES - 6 + 8) * FLASH_LOG_PAGE_ENTRIES), "append falhou");
+    CHECK(!flash_log_consume(&log, 4), "consumiu uma página apagada");
+    EXPECT_REPLAY(&log, pages_per_sector);
+    CHECK(log.pending == FLASH_LOG_PAGES - pages_per_sector + 8, "pending %u (esperado %lu)", log.pending,
+          (unsigned long)(FLASH_LOG_PAGES - pages_per_sector + 8));
+}
+
+/**
+ * @brief A trava da flash não vem a tempo: nada muda e a operação pode ser repetida.
+ */
+static void scenario_flash_error(void)
+{
+    FLASH_LOG_T log;
+    start("erro_de_flash", &log);
+    CHECK(append(&log, FLASH_LOG_PAGE_ENTRIES), "append falhou");
+
+    FLASH_LOG_T before = log;
+    chip_fail_next();
+    CHECK(!append(&log, FLASH_LOG_PAGE_ENTRIES), "append não informou a falha");
+    CHECK(log.head == before.head && log.pending == before.pending && log.sequence == before.sequence,
+          "estado mudou numa gravação que falhou");
+
+    uint8_t count;
+    uint32_t sequence;
+    CHECK(flash_log_replay(&log, &count, &sequence) != NULL, "página gravada sumiu");
+    chip_fail_next();
+    CHECK(!flash_log_consume(&log, sequence), "consume não informou a falha");
+    CHECK(log.pending == 1, "página marcada como enviada numa gravação que falhou");
+    flash_log_rewind(&log); // Como o laço principal faz quando nada mais está em voo
+
+    uint64_t expected = 0;
+    drain(&log, UINT32_MAX, &expected);
+    CHECK(expected == FLASH_LOG_PAGE_ENTRIES && flash_log_empty(&log), "página não foi reenviada depois da falha");
+}
+
+int main(void)
+{
+    printf("%u páginas de %u leituras em %u setores\n\n", FLASH_LOG_PAGES, (unsigned)FLASH_LOG_PAGE_ENTRIES,
+           FLASH_LOG_SECTORS);
+
+    scenario_order();
+    scenario_reboot();
+    scenario_overfill();
+    scenario_wear();
+    scenario_torn_page();
+    scenario_in_flight();
+    scenario_flash_error();
+
+    if (failures)
+        printf("\n%d falha(s)\n", failures);
+    else
+        printf("\nok\n");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,181 @@
+#!/usr/bin/env python3
+"""Gera o atlas de fontes do display (src/drivers/fonts.c).
+
+As três fontes são derivadas da font_8x5 do driver ssd1306:
+
+- font_small  (8 px):  a própria font_8x5, com as colunas vazias removidas
+- font_medium (16 px): ampliada 2x com Scale2x, que suaviza as diagonais
+- font_large  (24 px): ampliada 3x com Scale3x
+
+As larguras são proporcionais, exceto os dígitos, que têm todos a largura do
+mais largo para que números alinhados à direita não "dancem". Cada glifo é
+gravado por páginas (linhas de 8 pixels), no mesmo formato do framebuffer,
+para ser copiado byte a byte.
+
+Uso: fontgen.py <font.h> <fonts.c>
+"""
+
+import re
+import sys
+
+FONTS = (
+    # nome, fator de ampliação, espaçamento entre glifos, largura do espaço
+    ("font_small", 1, 1, 3),
+    ("font_medium", 2, 2, 5),
+    ("font_large", 3, 3, 7),
+)
+
+
+def parse_font(path):
+    """Lê a tabela font_8x5: altura, largura, espaçamento, primeiro, último, colunas."""
+    text = open(path).read()
+    body = text[text.index("{") + 1:text.index("}")]
+    values = [int(v, 0) for v in re.findall(r"0x[0-9A-Fa-f]+|\d+", body)]
+    height, width, _, first, last = values[:5]
+    data = values[5:]
+    glyphs = {}
+    for i, code in enumerate(range(first, last + 1)):
+        cols = data[i * width:(i + 1) * width]
+        glyphs[chr(code)] = [[(cols[x] >> y) & 1 for x in range(width)] for y in range(height)]
+    return height, first, last, glyphs
+
+
+def pixel(img, x, y):
+    if 0 <= y < len(img) and 0 <= x < len(img[0]):
+        return img[y][x]
+    return 0
+
+
+def scale2x(img):
+    h, w = len(img), len(img[0])
+    out = [[0] * (2 * w) for _ in range(2 * h)]
+    for y in range(h):
+        for x in range(w):
+            e = img[y][x]
+            b, d, f, hh = pixel(img, x, y - 1), pixel(img, x - 1, y), pixel(img, x + 1, y), pixel(img, x, y + 1)
+            out[2 * y][2 * x] = d if d == b and b != f and d != hh else e
+            out[2 * y][2 * x + 1] = f if b == f and b != d and f != hh else e
+            out[2 * y + 1][2 * x] = d if d == hh and d != b and hh != f else e
+            out[2 * y + 1][2 * x + 1] = f if hh == f and d != hh and b != f else e
+    return out
+
+
+def scale3x(img):
+    h, w = len(img), len(img[0])
+    out = [[0] * (3 * w) for _ in range(3 * h)]
+    for y in range(h):
+        for x in range(w):
+            a, b, c = pixel(img, x - 1, y - 1), pixel(img, x, y - 1), pixel(img, x + 1, y - 1)
+            d, e, f = pixel(img, x - 1, y), img[y][x], pixel(img, x + 1, y)
+            g, hh, i = pixel(img, x - 1, y + 1), pixel(img, x, y + 1), pixel(img, x + 1, y + 1)
+            if b != hh and d != f:
+                e0 = d if d == b else e
+                e1 = b if (d == b and e != c) or (b == f and e != a) else e
+                e2 = f if b == f else e
+                e3 = d if (d == b and e != g) or (d == hh and e != a) else e
+                e5 = f if (b == f and e != i) or (hh == f and e != c) else e
+                e6 = d if d == hh else e
+                e7 = hh if (d == hh and e != i) or (hh == f and e != g) else e
+                e8 = f if hh == f else e
+            else:
+                e0 = e1 = e2 = e3 = e5 = e6 = e7 = e8 = e
+            block = ((e0, e1, e2), (e3, e, e5), (e6, e7, e8))
+            for dy in range(3):
+                for dx in range(3):
+                    out[3 * y + dy][3 * x + dx] = block[dy][dx]
+    return out
+
+
+def trim(img, keep=None):
+    """Remove colunas vazias nas bordas; `keep` força uma largura (centralizando)."""
+    w = len(img[0])
+    used = [x for x in range(w) if any(row[x] for row in img)]
+    if not used:
+        return [row[:0] for row in img]
+    lo, hi = used[0], used[-1] + 1
+    if keep is not None:
+        pad = keep - (hi - lo)
+        lo = max(0, lo - pad // 2)
+        hi = min(w, lo + keep)
+        lo = hi - keep
+    return [row[lo:hi] for row in img]
+
+
+def to_pages(img, pages):
+    """Converte a imagem em bytes de página: página 0 (todas as colunas), página 1..."""
+    w = len(img[0]) if img else 0
+    out = []
+    for p in range(pages):
+        for x in range(w):
+            byte = 0
+            for bit in range(8):
+                y = p * 8 + bit
+                if y < len(img) and img[y][x]:
+                    byte |= 1 << bit
+            out.append(byte)
+    return out
+
+
+def emit(name, factor, spacing, space_width, height, first, last, glyphs):
+    scaler = {1: lambda g: g, 2: scale2x, 3: scale3x}[factor]
+    scaled = {c: scaler(g) for c, g in glyphs.items()}
+    digit_width = max(len(trim(scaled[c])[0]) for c in "0123456789")
+    h = height * factor
+    pages = (h + 7) // 8
+
+    data, table = [], []
+    for code in range(first, last + 1):
+        c = chr(code)
+        if c == " ":
+            img = [[0] * (space_width) for _ in range(h)]
+        else:
+            img = trim(scaled[c], digit_width if c.isdigit() else None)
+        width = len(img[0])
+        table.append((len(data), width, c))
+        data.extend(to_pages(img, pages))
+
+    lines = []
+    lines.append("/// Colunas de cada glifo de %s (páginas consecutivas de `width` bytes)" % name)
+    lines.append("static const uint8_t %s_data[%d] = {" % (name, len(data)))
+    for i in range(0, len(data), 16):
+        lines.append("    " + ", ".join("0x%02X" % v for v in data[i:i + 16]) + ",")
+    lines.append("};")
+    lines.append("")
+    lines.append("/// Posição e largura de cada glifo de %s" % name)
+    lines.append("static const font_glyph_t %s_glyphs[%d] = {" % (name, len(table)))
+    for offset, width, c in table:
+        label = c.replace("\\", "\\\\")
+        lines.append("    {%d, %d}, // '%s'" % (offset, width, label))
+    lines.append("};")
+    lines.append("")
+    lines.append("const font_t %s = {" % name)
+    lines.append("    .height = %d," % h)
+    lines.append("    .pages = %d," % pages)
+    lines.append("    .spacing = %d," % spacing)
+    lines.append("    .first = %d," % first)
+    lines.append("    .last = %d," % last)
+    lines.append("    .glyphs = %s_glyphs," % name)
+    lines.append("    .data = %s_data," % name)
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit(__doc__)
+    height, first, last, glyphs = parse_font(sys.argv[1])
+    parts = [
+        "// Gerado por tools/fontgen/fontgen.py a partir de external/ssd1306/font.h. Não editar.",
+        "",
+        '#include "fonts.h"',
+        "",
+    ]
+    for name, factor, spacing, space_width in FONTS:
+        parts.append(emit(name, factor, spacing, space_width, height, first, last, glyphs))
+        parts.append("")
+    with open(sys.argv[2], "w") as out:
+        out.write("\n".join(parts))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,21 @@
+/**
+ * @file ip_addr.h
+ * @brief Endereço IPv4 mínimo, no lugar do lwip/ip_addr.h.
+ */
+
+#ifndef SIM_LWIP_IP_ADDR_H
+#define SIM_LWIP_IP_ADDR_H
+
+#include <stdint.h>
+
+typedef struct
+{
+    uint32_t addr; ///< Endereço em ordem de host (10.0.0.1 = 0x0a000001)
+} ip_addr_t;
+
+#define IPADDR_TYPE_V4 0
+#define IP_GET_TYPE(ipaddr) IPADDR_TYPE_V4
+#define ip_addr_cmp(a, b) ((a)->addr == (b)->addr)
+#define ip_addr_copy(dest, src) ((dest) = (src))
+
+#endif
@@ -0,0 +1,24 @@
+/**
+ * @file pbuf.h
+ * @brief pbuf mínimo: o teste monta as cadeias na pilha e conta as liberações (net.c).
+ */
+
+#ifndef SIM_LWIP_PBUF_H
+#define SIM_LWIP_PBUF_H
+
+#include <stdint.h>
+
+typedef uint8_t u8_t;
+typedef uint16_t u16_t;
+
+struct pbuf
+{
+    struct pbuf *next; ///< Próximo segmento da cadeia
+    void *payload;     ///< Dados deste segmento
+    u16_t tot_len;     ///< Bytes deste segmento e dos seguintes
+    u16_t len;         ///< Bytes deste segmento
+};
+
+u8_t pbuf_free(struct pbuf *p);
+
+#endif
@@ -0,0 +1,66 @@
+/**
+ * @file tcp.h
+ * @brief API raw de TCP do lwIP, implementada por uma rede falsa (net.c).
+ */
+
+#ifndef SIM_LWIP_TCP_H
+#define SIM_LWIP_TCP_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "lwip/ip_addr.h"
+#include "lwip/pbuf.h"
+
+typedef int8_t err_t;
+
+#define ERR_OK 0
+#define ERR_MEM -1
+#define ERR_CONN -11
+#define ERR_ABRT -13
+#define ERR_RST -14
+
+#define TCP_WRITE_FLAG_COPY 0x01
+#define SOF_KEEPALIVE 0x08
+
+struct tcp_pcb;
+
+typedef err_t (*tcp_recv_fn)(void *arg, struct tcp_pcb *tpcb, struct pbuf *p, err_t err);
+typedef err_t (*tcp_sent_fn)(void *arg, struct tcp_pcb *tpcb, u16_t len);
+typedef void (*tcp_err_fn)(void *arg, err_t err);
+typedef err_t (*tcp_connected_fn)(void *arg, struct tcp_pcb *tpcb, err_t err);
+
+struct tcp_pcb
+{
+    void *callback_arg;
+    tcp_recv_fn recv;
+    tcp_sent_fn sent;
+    tcp_err_fn errf;
+    tcp_connected_fn connected;
+    uint8_t so_options;
+    bool nagle_disabled;
+    uint32_t keep_idle;
+    uint32_t keep_intvl;
+    uint32_t keep_cnt;
+    ip_addr_t remote_ip;
+    u16_t remote_port;
+    uint32_t unacked; ///< Bytes escritos e ainda não confirmados pelo servidor
+};
+
+#define ip_set_option(pcb, opt) ((pcb)->so_options |= (opt))
+
+struct tcp_pcb *tcp_new_ip_type(u8_t type);
+void tcp_arg(struct tcp_pcb *pcb, void *arg);
+void tcp_recv(struct tcp_pcb *pcb, tcp_recv_fn recv);
+void tcp_sent(struct tcp_pcb *pcb, tcp_sent_fn sent);
+void tcp_err(struct tcp_pcb *pcb, tcp_err_fn err);
+void tcp_nagle_disable(struct tcp_pcb *pcb);
+err_t tcp_connect(struct tcp_pcb *pcb, const ip_addr_t *ipaddr, u16_t port, tcp_connected_fn connected);
+u16_t tcp_sndbuf(const struct tcp_pcb *pcb);
+err_t tcp_write(struct tcp_pcb *pcb, const void *dataptr, u16_t len, u8_t apiflags);
+err_t tcp_output(struct tcp_pcb *pcb);
+void tcp_recved(struct tcp_pcb *pcb, u16_t len);
+err_t tcp_close(struct tcp_pcb *pcb);
+void tcp_abort(struct tcp_pcb *pcb);
+
+#endif
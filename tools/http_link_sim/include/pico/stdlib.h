@@ -0,0 +1,16 @@
+/**
+ * @file stdlib.h
+ * @brief Subconjunto do pico/stdlib.h usado pelo link HTTP, para compilação no host.
+ */
+
+#ifndef SIM_PICO_STDLIB_H
+#define SIM_PICO_STDLIB_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/// Relógio simulado: só anda quando o teste manda (net.c)
+uint64_t time_us_64(void);
+
+#endif
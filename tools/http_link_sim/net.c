@@ -0,0 +1,344 @@
+/**
+ * @file net.c
+ * @brief Rede falsa: API raw de TCP do lwIP, relógio simulado e o servidor do teste.
+ */
+
+#include "net.h"
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "pico/stdlib.h"
+
+/// Bytes recebidos pelo servidor e ainda não separados em requisições
+#define NET_RX_MAX 16384
+
+/// Requisições guardadas até net_take_requests()
+#define NET_REQUESTS_MAX 64
+
+static uint64_t now_us;
+static struct tcp_pcb *conn;
+static bool handshake;
+static int live_pcbs;
+static uint32_t connect_calls;
+static uint32_t sndbuf_limit;
+static bool fail_pcb;
+static ip_addr_t remote_ip;
+static uint16_t remote_port;
+static int pbufs_held;
+
+static char rx[NET_RX_MAX];
+static size_t rx_len;
+static char bodies[NET_REQUESTS_MAX][NET_BODY_MAX];
+static int body_count;
+
+uint64_t time_us_64(void)
+{
+    return now_us;
+}
+
+void net_reset(void)
+{
+    if (conn)
+    {
+        free(conn);
+        live_pcbs--;
+    }
+    conn = NULL;
+    handshake = false;
+    assert(live_pcbs == 0);
+    now_us = 0;
+    connect_calls = 0;
+    sndbuf_limit = UINT16_MAX;
+    fail_pcb = false;
+    pbufs_held = 0;
+    rx_len = 0;
+    body_count = 0;
+}
+
+void net_advance_us(uint64_t us)
+{
+    now_us += us;
+}
+
+void net_set_time_us(uint64_t t)
+{
+    now_us = t;
+}
+
+struct tcp_pcb *net_pcb(void)
+{
+    return conn;
+}
+
+bool net_connecting(void)
+{
+    return conn && handshake;
+}
+
+int net_live_pcbs(void)
+{
+    return live_pcbs;
+}
+
+uint32_t net_connect_calls(void)
+{
+    return connect_calls;
+}
+
+ip_addr_t net_remote_ip(void)
+{
+    return remote_ip;
+}
+
+uint16_t net_remote_port(void)
+{
+    return remote_port;
+}
+
+int net_pbufs_held(void)
+{
+    return pbufs_held;
+}
+
+void net_set_sndbuf(uint32_t bytes)
+{
+    sndbuf_limit = bytes;
+}
+
+void net_fail_next_pcb(void)
+{
+    fail_pcb = true;
+}
+
+/**
+ * @brief Libera um PCB; uma requisição pela metade na conexão se perde com ela.
+ */
+static void net_free(struct tcp_pcb *pcb)
+{
+    if (pcb == conn)
+    {
+        conn = NULL;
+        handshake = false;
+        rx_len = 0;
+    }
+    free(pcb);
+    live_pcbs--;
+}
+
+/**
+ * @brief Procura `needle` nos primeiros `len` bytes de `data`.
+ */
+static char *net_find(char *data, size_t len, const char *needle)
+{
+    size_t n = strlen(needle);
+    for (size_t i = 0; i + n <= len; ++i)
+        if (memcmp(data + i, needle, n) == 0)
+            return data + i;
+    return NULL;
+}
+
+/**
+ * @brief Separa as requisições completas pelo `Content-Length` e guarda o corpo de cada uma.
+ */
+static void net_parse_requests(void)
+{
+    while (true)
+    {
+        char *end = net_find(rx, rx_len, "\r\n\r\n");
+        if (!end)
+            return;
+        size_t header_len = (size_t)(end - rx) + 4;
+
+        size_t body_len = 0;
+        char *length = net_find(rx, header_len, "Content-Length: ");
+        if (length)
+            body_len = strtoul(length + 16, NULL, 10);
+        if (rx_len < header_len + body_len)
+            return;
+
+        assert(body_count < NET_REQUESTS_MAX && body_len < NET_BODY_MAX);
+        memcpy(bodies[body_count], rx + header_len, body_len);
+        bodies[body_count][body_len] = '\0';
+        body_count++;
+
+        rx_len -= header_len + body_len;
+        memmove(rx, rx + header_len + body_len, rx_len);
+    }
+}
+
+int net_take_requests(char out[][NET_BODY_MAX], int max)
+{
+    int n = body_count < max ? body_count : max;
+    memcpy(out, bodies, (size_t)n * NET_BODY_MAX);
+    body_count = 0;
+    return n;
+}
+
+void net_accept(void)
+{
+    assert(net_connecting());
+    handshake = false;
+    conn->connected(conn->callback_arg, conn, ERR_OK);
+}
+
+void net_refuse(void)
+{
+    assert(conn);
+    tcp_err_fn errf = conn->errf;
+    void *arg = conn->callback_arg;
+    net_free(conn); // O lwIP já liberou o PCB quando avisa o erro
+    if (errf)
+        errf(arg, ERR_RST);
+}
+
+void net_close(void)
+{
+    assert(conn && !handshake);
+    conn->recv(conn->callback_arg, conn, NULL, ERR_OK);
+}
+
+void net_respond(const char *data, size_t segment)
+{
+    assert(conn && !handshake);
+    size_t len = strlen(data);
+    size_t count = (len + segment - 1) / segment;
+    struct pbuf *chain = calloc(count, sizeof(struct pbuf));
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        size_t offset = i * segment;
+        chain[i].payload = (void *)(data + offset);
+        chain[i].len = (u16_t)(len - offset < segment ? len - offset : segment);
+        chain[i].tot_len = (u16_t)(len - offset);
+        chain[i].next = i + 1 < count ? &chain[i + 1] : NULL;
+    }
+
+    pbufs_held++;
+    conn->recv(conn->callback_arg, conn, chain, ERR_OK);
+    free(chain);
+}
+
+void net_respond_pieces(const char *data, size_t piece)
+{
+    char buffer[NET_RX_MAX];
+    size_t len = strlen(data);
+    for (size_t offset = 0; offset < len && conn; offset += piece)
+    {
+        size_t n = len - offset < piece ? len - offset : piece;
+        memcpy(buffer, data + offset, n);
+        buffer[n] = '\0';
+        net_respond(buffer, n);
+    }
+}
+
+void net_ack(void)
+{
+    assert(conn && !handshake);
+    u16_t len = (u16_t)conn->unacked;
+    conn->unacked = 0;
+    if (conn->sent)
+        conn->sent(conn->callback_arg, conn, len);
+}
+
+u8_t pbuf_free(struct pbuf *p)
+{
+    pbufs_held--;
+    return 1;
+}
+
+struct tcp_pcb *tcp_new_ip_type(u8_t type)
+{
+    if (fail_pcb)
+    {
+        fail_pcb = false;
+        return NULL;
+    }
+    live_pcbs++;
+    return calloc(1, sizeof(struct tcp_pcb));
+}
+
+void tcp_arg(struct tcp_pcb *pcb, void *arg)
+{
+    pcb->callback_arg = arg;
+}
+
+void tcp_recv(struct tcp_pcb *pcb, tcp_recv_fn recv)
+{
+    pcb->recv = recv;
+}
+
+void tcp_sent(struct tcp_pcb *pcb, tcp_sent_fn sent)
+{
+    pcb->sent = sent;
+}
+
+void tcp_err(struct tcp_pcb *pcb, tcp_err_fn err)
+{
+    pcb->errf = err;
+}
+
+void tcp_nagle_disable(struct tcp_pcb *pcb)
+{
+    pcb->nagle_disabled = true;
+}
+
+err_t tcp_connect(struct tcp_pcb *pcb, const ip_addr_t *ipaddr, u16_t port, tcp_connected_fn connected)
+{
+    assert(!conn); // O link nunca abre uma segunda conexão
+    conn = pcb;
+    handshake = true;
+    rx_len = 0;
+    pcb->connected = connected;
+    pcb->remote_ip = *ipaddr;
+    pcb->remote_port = port;
+    remote_ip = *ipaddr;
+    remote_port = port;
+    connect_calls++;
+    return ERR_OK;
+}
+
+u16_t tcp_sndbuf(const struct tcp_pcb *pcb)
+{
+    uint32_t free_bytes = pcb->unacked < sndbuf_limit ? sndbuf_limit - pcb->unacked : 0;
+    return (u16_t)(free_bytes < UINT16_MAX ? free_bytes : UINT16_MAX);
+}
+
+err_t tcp_write(struct tcp_pcb *pcb, const void *dataptr, u16_t len, u8_t apiflags)
+{
+    assert(pcb == conn && !handshake);
+    if (len > tcp_sndbuf(pcb))
+        return ERR_MEM;
+
+    assert(rx_len + len <= sizeof(rx));
+    memcpy(rx + rx_len, dataptr, len);
+    rx_len += len;
+    pcb->unacked += len;
+    net_parse_requests();
+    return ERR_OK;
+}
+
+err_t tcp_output(struct tcp_pcb *pcb)
+{
+    return ERR_OK;
+}
+
+void tcp_recved(struct tcp_pcb *pcb, u16_t len)
+{
+}
+
+err_t tcp_close(struct tcp_pcb *pcb)
+{
+    net_free(pcb);
+    return ERR_OK;
+}
+
+void tcp_abort(struct tcp_pcb *pcb)
+{
+    tcp_err_fn errf = pcb->errf;
+    void *arg = pcb->callback_arg;
+    net_free(pcb);
+    if (errf)
+        errf(arg, ERR_ABRT);
+}
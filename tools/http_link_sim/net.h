@@ -0,0 +1,119 @@
+/**
+ * @file net.h
+ * @brief Rede falsa para o link HTTP: a API raw de TCP do lwIP de um lado e um
+ *        servidor controlado pelo teste do outro.
+ *
+ * Há no máximo uma conexão por vez, como no link. O servidor separa as
+ * requisições recebidas pelo `Content-Length` e guarda o corpo de cada uma. O
+ * teste decide quando o handshake termina ou é recusado, quando o servidor
+ * responde (em quantos pedaços), fecha ou derruba a conexão, e quando os bytes
+ * escritos são confirmados.
+ */
+
+#ifndef NET_H
+#define NET_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "lwip/tcp.h"
+
+/// Maior corpo de requisição guardado pelo servidor
+#define NET_BODY_MAX 32
+
+/**
+ * @brief Fecha tudo, zera os contadores e volta o relógio a zero.
+ */
+void net_reset(void);
+
+/**
+ * @brief Avança o relógio simulado (time_us_64()).
+ */
+void net_advance_us(uint64_t us);
+
+/**
+ * @brief Põe o relógio simulado num instante absoluto.
+ */
+void net_set_time_us(uint64_t now_us);
+
+/**
+ * @brief Conexão atual (aberta ou em handshake), ou NULL.
+ */
+struct tcp_pcb *net_pcb(void);
+
+/**
+ * @brief Se há um handshake esperando net_accept() ou net_refuse().
+ */
+bool net_connecting(void);
+
+/**
+ * @brief PCBs criados e ainda não liberados (deve ser 0 ou 1).
+ */
+int net_live_pcbs(void);
+
+/**
+ * @brief Chamadas de tcp_connect desde net_reset().
+ */
+uint32_t net_connect_calls(void);
+
+/**
+ * @brief Completa o handshake.
+ */
+void net_accept(void);
+
+/**
+ * @brief Recusa o handshake ou derruba a conexão (RST): o lwIP libera o PCB e chama o callback de erro.
+ */
+void net_refuse(void);
+
+/**
+ * @brief O servidor fecha a conexão (recv com pbuf NULL).
+ */
+void net_close(void);
+
+/**
+ * @brief Entrega bytes do servidor numa só chamada de recv, numa cadeia de pbufs de `segment` bytes.
+ */
+void net_respond(const char *data, size_t segment);
+
+/**
+ * @brief Entrega bytes do servidor em chamadas de recv separadas, de `piece` bytes cada.
+ */
+void net_respond_pieces(const char *data, size_t piece);
+
+/**
+ * @brief Limita o buffer de envio (bytes escritos e não confirmados).
+ */
+void net_set_sndbuf(uint32_t bytes);
+
+/**
+ * @brief O servidor confirma tudo o que foi escrito (chama o callback sent).
+ */
+void net_ack(void);
+
+/**
+ * @brief Faz a próxima chamada de tcp_new_ip_type falhar.
+ */
+void net_fail_next_pcb(void);
+
+/**
+ * @brief Corpos das requisições completas recebidas desde a última chamada, em ordem.
+ * @param bodies Recebe os corpos.
+ * @param max Quantidade máxima.
+ * @return Quantidade de requisições.
+ */
+int net_take_requests(char bodies[][NET_BODY_MAX], int max);
+
+/**
+ * @brief Endereço e porta da última chamada de tcp_connect.
+ */
+ip_addr_t net_remote_ip(void);
+uint16_t net_remote_port(void);
+
+/**
+ * @brief pbufs entregues e ainda não liberados pelo link.
+ */
+int net_pbufs_held(void);
+
+#endif
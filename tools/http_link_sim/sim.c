@@ -0,0 +1,538 @@
+/**
+ * @file sim.c
+ * @brief Testes do link HTTP persistente (http_link.c) no host, sobre a rede falsa de net.c.
+ *
+ * Uso: http_link_sim
+ *
+ * Cada cenário envia requisições numeradas (o número vai no corpo), conduz o
+ * servidor falso (handshake, respostas, quedas) e confere o que o servidor
+ * recebeu, o estado do link e os seus contadores.
+ *
+ * Retorna 1 se algum cenário falhar.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "pico/stdlib.h"
+
+#include "http_link.h"
+#include "net.h"
+
+/// Resposta mínima de sucesso
+#define SIM_OK "HTTP/1.1 200 OK\r\nContent-Length: 0\r\n\r\n"
+
+static int failures = 0;
+
+#define CHECK(cond, ...)                                                                                               \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        if (!(cond))                                                                                                   \
+        {                                                                                                              \
+            printf("  FALHA (%s:%d): ", __FILE__, __LINE__);                                                           \
+            printf(__VA_ARGS__);                                                                                       \
+            printf("\n");                                                                                              \
+            failures++;                                                                                                \
+        }                                                                                                              \
+    } while (0)
+
+static const ip_addr_t server_a = {.addr = 0x0a000001}; // 10.0.0.1
+static const ip_addr_t server_b = {.addr = 0x0a000002}; // 10.0.0.2
+
+/**
+ * @brief Rede limpa, relógio em 1 s e o link apontado para o servidor A.
+ */
+static void start(const char *name, HTTP_LINK_T *link)
+{
+    printf("%s\n", name);
+    net_reset();
+    net_set_time_us(1000000);
+    http_link_init(link);
+    http_link_set_server(link, &server_a, 5000);
+}
+
+/**
+ * @brief Enfileira a requisição de corpo `id`, carimbada com o instante atual.
+ */
+static bool send(HTTP_LINK_T *link, const char *id)
+{
+    char request[128];
+    int len = snprintf(request, sizeof(request), "POST /r HTTP/1.1\r\nHost: sim\r\nContent-Length: %u\r\n\r\n%s",
+                       (unsigned)strlen(id), id);
+    return http_link_send(link, request, (uint16_t)len, time_us_64(), HTTP_LINK_NO_TAG);
+}
+
+/**
+ * @brief Enfileira a requisição de corpo `id` com a marca `tag`, como uma página reenviada do log.
+ */
+static bool send_tagged(HTTP_LINK_T *link, const char *id, uint32_t tag)
+{
+    char request[128];
+    int len = snprintf(request, sizeof(request), "POST /r HTTP/1.1\r\nHost: sim\r\nContent-Length: %u\r\n\r\n%s",
+                       (unsigned)strlen(id), id);
+    return http_link_send(link, request, (uint16_t)len, time_us_64(), tag);
+}
+
+/**
+ * @brief Confere as marcas respondidas desde a última chamada, em ordem (separadas por espaço).
+ */
+static void expect_answered(HTTP_LINK_T *link, const char *expected, int line)
+{
+    char got[64] = "";
+    uint32_t tag;
+    while (http_link_take_answered(link, &tag))
+        snprintf(got + strlen(got), sizeof(got) - strlen(got), "%s%lu", got[0] ? " " : "", (unsigned long)tag);
+    if (strcmp(got, expected) != 0)
+    {
+        printf("  FALHA (linha %d): marcas respondidas \"%s\", esperado \"%s\"\n", line, got, expected);
+        failures++;
+    }
+}
+#define EXPECT_ANSWERED(link, expected) expect_answered(link, expected, __LINE__)
+
+/**
+ * @brief Confere que o servidor recebeu exatamente estas requisições, nesta ordem (separadas por espaço).
+ */
+static void expect_requests(const char *expected, int line)
+{
+    char bodies[16][NET_BODY_MAX];
+    int n = net_take_requests(bodies, 16);
+
+    char got[256] = "";
+    for (int i = 0; i < n; ++i)
+    {
+        strcat(got, i ? " " : "");
+        strcat(got, bodies[i]);
+    }
+    if (strcmp(got, expected) != 0)
+    {
+        printf("  FALHA (linha %d): servidor recebeu \"%s\", esperado \"%s\"\n", line, got, expected);
+        failures++;
+    }
+}
+#define EXPECT_REQUESTS(expected) expect_requests(expected, __LINE__)
+
+#define EXPECT_STATE(link, expected)                                                                                   \
+    CHECK((link)->state == (expected), "estado %s, esperado %s", http_link_state_name((link)->state),                  \
+          http_link_state_name(expected))
+
+/**
+ * @brief Avança o relógio até o fim da espera e deixa o link reconectar.
+ */
+static void end_backoff(HTTP_LINK_T *link)
+{
+    net_set_time_us(link->deadline_us);
+    http_link_poll(link, time_us_64());
+}
+
+/**
+ * @brief Quatro requisições antes do handshake saem juntas na mesma conexão, e
+ *        as respostas abrem espaço na janela para as seguintes.
+ */
+static void scenario_pipelining(void)
+{
+    HTTP_LINK_T link;
+    start("pipelining", &link);
+
+    CHECK(send(&link, "1"), "primeira requisição recusada");
+    EXPECT_STATE(&link, HTTP_LINK_CONNECTING);
+    CHECK(send(&link, "2") && send(&link, "3") && send(&link, "4"), "requisições recusadas durante o handshake");
+    CHECK(!http_link_ready(&link) && !send(&link, "5"), "janela cheia aceitou mais uma");
+    EXPECT_REQUESTS("");
+
+    net_accept();
+    EXPECT_REQUESTS("1 2 3 4");
+    EXPECT_STATE(&link, HTTP_LINK_AWAITING_RESPONSE);
+    CHECK(net_pcb()->nagle_disabled && (net_pcb()->so_options & SOF_KEEPALIVE), "Nagle ou keep-alive do TCP");
+
+    net_respond(SIM_OK SIM_OK, 1024); // Duas respostas no mesmo segmento
+    CHECK(link.used == 2, "em voo %u, esperado 2", link.used);
+    EXPECT_STATE(&link, HTTP_LINK_SENDING);
+    CHECK(send(&link, "5"), "janela com espaço recusou");
+    EXPECT_REQUESTS("5");
+
+    net_respond(SIM_OK SIM_OK SIM_OK, 1024);
+    CHECK(link.used == 0, "em voo %u depois de todas as respostas", link.used);
+    CHECK(link.connects == 1 && link.requests == 5 && link.reused == 4 && link.responses == 5,
+          "conexoes=%lu requisicoes=%lu reaproveitadas=%lu respostas=%lu", (unsigned long)link.connects,
+          (unsigned long)link.requests, (unsigned long)link.reused, (unsigned long)link.responses);
+    CHECK(net_connect_calls() == 1 && net_pbufs_held() == 0, "conexões %lu, pbufs retidos %d",
+          (unsigned long)net_connect_calls(), net_pbufs_held());
+}
+
+/**
+ * @brief Respostas com corpo, chunked e vazias, partidas em qualquer byte: em
+ *        cadeias de pbufs de 1 byte e em chamadas de recv separadas.
+ */
+static void scenario_split_responses(void)
+{
+    static const char *responses = "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\nContent-Length: 27\r\n\r\n"
+                                   "{\"detail\": \"3 readings ok\"}"
+                                   "HTTP/1.1 201 Created\r\nTransfer-Encoding: chunked\r\n\r\n"
+                                   "4\r\nabcd\r\n3;ext=1\r\nefg\r\n0\r\nX-Trailer: 1\r\n\r\n"
+                                   "HTTP/1.1 204 No Content\r\n\r\n";
+    static const size_t pieces[] = {1, 2, 7, 13};
+
+    HTTP_LINK_T link;
+    start("respostas_partidas", &link);
+    uint32_t sent = 0;
+
+    send(&link, "a");
+    net_accept();
+    net_respond(SIM_OK, 1024);
+
+    for (size_t chain = 1; chain <= 3; ++chain)
+    { // Uma chamada de recv, cadeia de pbufs de `chain` bytes
+        send(&link, "b");
+        send(&link, "c");
+        send(&link, "d");
+        sent += 3;
+        net_respond(responses, chain);
+        CHECK(link.used == 0, "cadeia de %zu bytes: %u sem resposta", chain, link.used);
+    }
+    for (size_t i = 0; i < sizeof(pieces) / sizeof(pieces[0]); ++i)
+    { // Uma chamada de recv por pedaço
+        send(&link, "b");
+        send(&link, "c");
+        send(&link, "d");
+        sent += 3;
+        net_respond_pieces(responses, pieces[i]);
+        CHECK(link.used == 0, "pedaços de %zu bytes: %u sem resposta", pieces[i], link.used);
+    }
+
+    CHECK(link.responses == sent + 1, "respostas %lu, esperadas %lu", (unsigned long)link.responses,
+          (unsigned long)(sent + 1));
+    CHECK(link.parse_errors == 0 && link.connects == 1, "erros de análise %lu, conexões %lu",
+          (unsigned long)link.parse_errors, (unsigned long)link.connects);
+    CHECK(link.last_status == 204, "último status %u", link.last_status);
+    CHECK(net_pbufs_held() == 0, "%d pbufs retidos", net_pbufs_held());
+}
+
+/**
+ * @brief Conexões recusadas em sequência: a espera dobra a partir de 500 ms até
+ *        o teto de 30 s, e volta ao início depois de uma resposta.
+ */
+static void scenario_backoff(void)
+{
+    static const uint32_t expected_ms[] = {500, 1000, 2000, 4000, 8000, 16000, 30000, 30000};
+
+    HTTP_LINK_T link;
+    start("espera", &link);
+    send(&link, "1");
+
+    for (size_t i = 0; i < sizeof(expected_ms) / sizeof(expected_ms[0]); ++i)
+    {
+        CHECK(net_connecting(), "tentativa %zu não conectou", i + 1);
+        uint32_t calls = net_connect_calls();
+        net_refuse();
+        EXPECT_STATE(&link, HTTP_LINK_BACKOFF);
+
+        uint64_t wait_ms = (link.deadline_us - time_us_64()) / 1000;
+        CHECK(wait_ms == expected_ms[i], "espera %zu: %llu ms, esperado %lu ms", i + 1, (unsigned long long)wait_ms,
+              (unsigned long)expected_ms[i]);
+        CHECK(http_link_next_event_us(&link) == link.deadline_us, "próximo evento fora do fim da espera");
+        CHECK(!http_link_ready(&link) && !send(&link, "x"), "link aceitou requisição durante a espera");
+
+        net_set_time_us(link.deadline_us - 1);
+        http_link_poll(&link, time_us_64());
+        CHECK(net_connect_calls() == calls, "reconectou antes do fim da espera");
+        end_backoff(&link);
+    }
+
+    net_accept();
+    EXPECT_REQUESTS("1");
+    CHECK(link.retries == 0 && link.lost == 0, "recusas antes do handshake contaram como tentativas");
+    net_respond(SIM_OK, 1024);
+
+    send(&link, "2");
+    EXPECT_REQUESTS("2");
+    net_refuse(); // Conexão cai depois de uma resposta: a espera recomeça do mínimo
+    CHECK((link.deadline_us - time_us_64()) / 1000 == 500, "espera não voltou ao mínimo: %llu ms",
+          (unsigned long long)((link.deadline_us - time_us_64()) / 1000));
+    CHECK(link.failures == 9, "falhas %lu, esperado 9", (unsigned long)link.failures);
+}
+
+/**
+ * @brief Reenvios: fechamento pelo servidor (sem espera), 5xx, tempo esgotado,
+ *        resposta malformada e 4xx (sem reenvio), até desistir após
+ *        HTTP_LINK_MAX_ATTEMPTS escritas.
+ */
+static void scenario_retries(void)
+{
+    HTTP_LINK_T link;
+    start("reenvios", &link);
+
+    send(&link, "1");
+    send(&link, "2");
+    send(&link, "3");
+    net_accept();
+    EXPECT_REQUESTS("1 2 3");
+    net_respond(SIM_OK, 1024);
+
+    // O servidor fecha com 2 e 3 sem resposta: reconecta sem espera e escreve os dois de novo
+    net_close();
+    EXPECT_STATE(&link, HTTP_LINK_IDLE);
+    CHECK(http_link_next_event_us(&link) == 0, "link ocioso com requisições pendentes não pediu para acordar");
+    http_link_poll(&link, time_us_64());
+    net_accept();
+    EXPECT_REQUESTS("2 3");
+    CHECK(link.drops == 1 && link.retries == 2, "quedas=%lu reenvios=%lu", (unsigned long)link.drops,
+          (unsigned long)link.retries);
+
+    // 503 para 2: tudo o que está sem resposta volta depois da espera
+    net_respond("HTTP/1.1 503 Service Unavailable\r\nContent-Length: 0\r\n\r\n", 1024);
+    EXPECT_STATE(&link, HTTP_LINK_BACKOFF);
+    CHECK(link.server_errors == 1 && net_live_pcbs() == 0, "erros do servidor %lu, PCBs vivos %d",
+          (unsigned long)link.server_errors, net_live_pcbs());
+    end_backoff(&link);
+    net_accept();
+    EXPECT_REQUESTS("2 3");
+
+    // 2 e 3 já foram escritas 3 vezes: depois do tempo esgotado, são abandonadas
+    net_advance_us(HTTP_LINK_RESPONSE_TIMEOUT_MS * 1000ull - 1);
+    http_link_poll(&link, time_us_64());
+    EXPECT_STATE(&link, HTTP_LINK_SENDING);
+    net_advance_us(1);
+    http_link_poll(&link, time_us_64());
+    EXPECT_STATE(&link, HTTP_LINK_BACKOFF);
+    CHECK(link.timeouts == 1 && net_live_pcbs() == 0, "timeouts %lu, PCBs vivos %d", (unsigned long)link.timeouts,
+          net_live_pcbs());
+    end_backoff(&link);
+    CHECK(net_connecting(), "não reconectou depois do tempo esgotado");
+    net_accept();
+    EXPECT_REQUESTS("");
+    CHECK(link.lost == 2 && link.used == 0, "perdidas %lu, em voo %u", (unsigned long)link.lost, link.used);
+
+    // 4xx: recusada de vez, sem reenvio e sem derrubar a conexão
+    send(&link, "4");
+    EXPECT_REQUESTS("4");
+    net_respond("HTTP/1.1 400 Bad Request\r\nContent-Length: 2\r\n\r\n{}", 1024);
+    CHECK(link.rejected == 1 && link.used == 0 && net_pcb(), "rejeitadas %lu, em voo %u", (unsigned long)link.rejected,
+          link.used);
+
+    // Resposta malformada: a conexão é refeita e a requisição reenviada
+    send(&link, "5");
+    EXPECT_REQUESTS("5");
+    net_respond("HTTP/1.1 2x0 OK\r\n\r\n", 1024);
+    CHECK(link.parse_errors == 1, "resposta malformada não foi contada");
+    EXPECT_STATE(&link, HTTP_LINK_BACKOFF);
+    end_backoff(&link);
+    net_accept();
+    EXPECT_REQUESTS("5");
+
+    // Connection: close depois da resposta: reconecta só quando houver o que enviar
+    net_respond("HTTP/1.1 200 OK\r\nConnection: close\r\nContent-Length: 0\r\n\r\n", 1024);
+    EXPECT_STATE(&link, HTTP_LINK_IDLE);
+    CHECK(net_live_pcbs() == 0 && link.drops == 2, "PCBs vivos %d, quedas %lu", net_live_pcbs(),
+          (unsigned long)link.drops);
+    http_link_poll(&link, time_us_64());
+    CHECK(!net_connecting(), "reconectou sem requisições pendentes");
+}
+
+/**
+ * @brief Um 503 no meio das respostas: as que chegaram atrás dele retiram as
+ *        suas requisições, e só a que falhou e as sem resposta são reenviadas.
+ */
+static void scenario_retry_mid_pipeline(void)
+{
+    HTTP_LINK_T link;
+    start("nova_tentativa_no_meio", &link);
+
+    send(&link, "1");
+    send(&link, "2");
+    send(&link, "3");
+    send(&link, "4");
+    net_accept();
+    EXPECT_REQUESTS("1 2 3 4");
+
+    net_respond(SIM_OK "HTTP/1.1 503 Service Unavailable\r\nContent-Length: 0\r\n\r\n" SIM_OK, 16);
+    EXPECT_STATE(&link, HTTP_LINK_BACKOFF);
+    CHECK(link.responses == 2 && link.server_errors == 1 && link.used == 2, "respostas=%lu erros=%lu em voo %u",
+          (unsigned long)link.responses, (unsigned long)link.server_errors, link.used);
+    end_backoff(&link);
+    net_accept();
+    EXPECT_REQUESTS("2 4");
+    net_respond(SIM_OK SIM_OK, 1024);
+    CHECK(link.used == 0 && link.responses == 4 && link.retries == 2, "em voo %u, respostas %lu, reenvios %lu",
+          link.used, (unsigned long)link.responses, (unsigned long)link.retries);
+
+    // Dois 503 seguidos: as duas ficam na ordem em que foram escritas
+    send(&link, "5");
+    send(&link, "6");
+    send(&link, "7");
+    EXPECT_REQUESTS("5 6 7");
+    net_respond("HTTP/1.1 503 Service Unavailable\r\nContent-Length: 0\r\n\r\n"
+                "HTTP/1.1 429 Too Many Requests\r\nContent-Length: 0\r\n\r\n" SIM_OK,
+                1024);
+    end_backoff(&link);
+    net_accept();
+    EXPECT_REQUESTS("5 6");
+    CHECK(net_pbufs_held() == 0, "%d pbufs retidos", net_pbufs_held());
+}
+
+/**
+ * @brief Requisições marcadas: a marca volta só com a resposta final (2xx ou
+ *        4xx), e a requisição nunca é abandonada, mesmo depois de
+ *        HTTP_LINK_MAX_ATTEMPTS escritas.
+ */
+static void scenario_tagged(void)
+{
+    HTTP_LINK_T link;
+    start("requisicoes_marcadas", &link);
+
+    send_tagged(&link, "p7", 7);
+    send(&link, "1");
+    send_tagged(&link, "p8", 8);
+    net_accept();
+    EXPECT_REQUESTS("p7 1 p8");
+    CHECK(http_link_tagged(&link) == 2, "%u marcadas em voo, esperado 2", http_link_tagged(&link));
+    EXPECT_ANSWERED(&link, "");
+
+    for (int i = 0; i < HTTP_LINK_MAX_ATTEMPTS + 2; ++i)
+    { // O servidor cai antes de responder, várias vezes
+        net_refuse();
+        end_backoff(&link);
+        net_accept();
+        EXPECT_REQUESTS(i + 1 < HTTP_LINK_MAX_ATTEMPTS ? "p7 1 p8" : "p7 p8");
+    }
+    CHECK(link.lost == 1 && http_link_tagged(&link) == 2, "perdidas %lu, marcadas em voo %u",
+          (unsigned long)link.lost, http_link_tagged(&link));
+    EXPECT_ANSWERED(&link, "");
+
+    // 503 não é resposta final; 400 é (a página seria recusada de novo)
+    net_respond("HTTP/1.1 503 Service Unavailable\r\nContent-Length: 0\r\n\r\n"
+                "HTTP/1.1 400 Bad Request\r\nContent-Length: 0\r\n\r\n", 1024);
+    EXPECT_ANSWERED(&link, "8");
+    end_backoff(&link);
+    net_accept();
+    EXPECT_REQUESTS("p7");
+    net_respond(SIM_OK, 1024);
+    EXPECT_ANSWERED(&link, "7");
+    CHECK(http_link_tagged(&link) == 0 && link.used == 0, "marcadas em voo %u, em voo %u", http_link_tagged(&link),
+          link.used);
+}
+
+/**
+ * @brief Amostra de relógio: só uma requisição respondida na primeira escrita fica como amostra.
+ */
+static void scenario_clock_sample(void)
+{
+    HTTP_LINK_T link;
+    start("amostra_de_relogio", &link);
+
+    uint64_t first_stamp = time_us_64();
+    send(&link, "1");
+    net_accept();
+    net_advance_us(20000);
+    net_respond(SIM_OK, 1024);
+    CHECK(link.clock_sent_us == first_stamp && link.clock_answered_us == time_us_64(),
+          "amostra %llu/%llu, esperada %llu/%llu", (unsigned long long)link.clock_sent_us,
+          (unsigned long long)link.clock_answered_us, (unsigned long long)first_stamp,
+          (unsigned long long)time_us_64());
+
+    net_advance_us(1000000);
+    send(&link, "2");
+    net_close();
+    http_link_poll(&link, time_us_64());
+    net_accept();
+    net_respond(SIM_OK, 1024);
+    CHECK(link.clock_sent_us == first_stamp, "requisição reenviada virou amostra de relógio");
+}
+
+/**
+ * @brief Troca de servidor: a conexão cai, a espera é cancelada e as requisições
+ *        sem resposta vão para o servidor novo.
+ */
+static void scenario_new_server(void)
+{
+    HTTP_LINK_T link;
+    start("servidor_novo", &link);
+
+    CHECK(!http_link_ready(&(HTTP_LINK_T){0}), "link sem servidor aceitou requisição");
+    send(&link, "1");
+    send(&link, "2");
+    net_accept();
+    EXPECT_REQUESTS("1 2");
+
+    http_link_set_server(&link, &server_a, 5000); // O mesmo servidor: nada muda
+    CHECK(net_pcb() && net_connect_calls() == 1, "o mesmo servidor derrubou a conexão");
+
+    http_link_set_server(&link, &server_b, 8080);
+    CHECK(net_live_pcbs() == 0, "conexão com o servidor antigo não foi fechada");
+    EXPECT_STATE(&link, HTTP_LINK_IDLE);
+    http_link_poll(&link, time_us_64());
+    CHECK(net_connecting() && net_remote_ip().addr == server_b.addr && net_remote_port() == 8080,
+          "não conectou ao servidor novo");
+    net_accept();
+    EXPECT_REQUESTS("1 2");
+
+    // Durante a espera, um servidor novo cancela a espera
+    net_refuse();
+    EXPECT_STATE(&link, HTTP_LINK_BACKOFF);
+    http_link_set_server(&link, &server_a, 5000);
+    EXPECT_STATE(&link, HTTP_LINK_IDLE);
+    http_link_poll(&link, time_us_64());
+    CHECK(net_connecting() && net_remote_ip().addr == server_a.addr, "espera não foi cancelada");
+    net_accept();
+    EXPECT_REQUESTS("1 2");
+    net_respond(SIM_OK SIM_OK, 1024);
+    CHECK(link.used == 0, "em voo %u", link.used);
+}
+
+/**
+ * @brief Buffer de envio cheio: as requisições esperam nos slots e saem quando
+ *        o servidor confirma os bytes; sem PCB, o link entra em espera.
+ */
+static void scenario_send_buffer(void)
+{
+    HTTP_LINK_T link;
+    start("buffer_de_envio", &link);
+
+    net_set_sndbuf(80); // Cabe uma requisição por vez
+    send(&link, "1");
+    send(&link, "2");
+    send(&link, "3");
+    net_accept();
+    EXPECT_REQUESTS("1");
+    net_ack();
+    EXPECT_REQUESTS("2");
+    net_ack();
+    EXPECT_REQUESTS("3");
+    net_respond(SIM_OK SIM_OK SIM_OK, 1024);
+    CHECK(link.used == 0 && link.requests == 3, "em voo %u, requisições %lu", link.used,
+          (unsigned long)link.requests);
+
+    net_close();
+    net_fail_next_pcb();
+    send(&link, "4");
+    EXPECT_STATE(&link, HTTP_LINK_BACKOFF);
+    CHECK(link.failures == 1 && link.used == 1, "falha ao criar o PCB: falhas %lu, em voo %u",
+          (unsigned long)link.failures, link.used);
+    end_backoff(&link);
+    net_accept();
+    EXPECT_REQUESTS("4");
+}
+
+int main(void)
+{
+    printf("janela de %u requisições, %u tentativas cada\n\n", HTTP_LINK_WINDOW, HTTP_LINK_MAX_ATTEMPTS);
+
+    scenario_pipelining();
+    scenario_split_responses();
+    scenario_backoff();
+    scenario_retries();
+    scenario_retry_mid_pipeline();
+    scenario_tagged();
+    scenario_clock_sample();
+    scenario_new_server();
+    scenario_send_buffer();
+
+    if (net_live_pcbs() > 1)
+        CHECK(false, "%d PCBs vivos no fim", net_live_pcbs());
+
+    if (failures)
+        printf("\n%d falha(s)\n", failures);
+    else
+        printf("\nok\n");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,184 @@
+/**
+ * @file dns_server.c
+ * @brief Servidor DNS falso, tabela do lwIP, conversões de endereço e relógio simulado.
+ */
+
+#include "dns_server.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "pico/stdlib.h"
+
+/// Nomes no servidor (e entradas na tabela)
+#define DNS_SERVER_NAMES 8
+
+/// Consultas em aberto ao mesmo tempo
+#define DNS_SERVER_QUERIES 8
+
+/// Maior nome aceito
+#define DNS_SERVER_NAME_MAX 64
+
+/**
+ * @brief Registro no servidor e a cópia dele na tabela do lwIP.
+ */
+typedef struct
+{
+    char name[DNS_SERVER_NAME_MAX]; ///< Nome (vazio = livre)
+    ip_addr_t addr;                 ///< Endereço atual no servidor
+    uint32_t ttl_s;                 ///< TTL das respostas
+    bool cached;                    ///< A tabela tem uma resposta
+    ip_addr_t cached_addr;          ///< Endereço da resposta na tabela
+    uint64_t expires_us;            ///< Fim do TTL da resposta na tabela
+} dns_record_t;
+
+/**
+ * @brief Consulta esperando dns_server_answer().
+ */
+typedef struct
+{
+    char name[DNS_SERVER_NAME_MAX];
+    dns_found_callback found;
+    void *arg;
+} dns_query_t;
+
+static uint64_t now_us;
+static dns_record_t records[DNS_SERVER_NAMES];
+static dns_query_t queries[DNS_SERVER_QUERIES];
+static int query_count;
+static uint32_t sent_queries;
+static err_t next_error;
+
+uint64_t time_us_64(void)
+{
+    return now_us;
+}
+
+void dns_server_reset(void)
+{
+    now_us = 0;
+    memset(records, 0, sizeof(records));
+    query_count = 0;
+    sent_queries = 0;
+    next_error = ERR_OK;
+}
+
+void dns_server_advance_us(uint64_t us)
+{
+    now_us += us;
+}
+
+static dns_record_t *dns_server_find(const char *name)
+{
+    for (int i = 0; i < DNS_SERVER_NAMES; ++i)
+        if (strcmp(records[i].name, name) == 0)
+            return &records[i];
+    return NULL;
+}
+
+void dns_server_set(const char *name, const char *addr, uint32_t ttl_s)
+{
+    dns_record_t *record = dns_server_find(name);
+    if (!record)
+    {
+        record = dns_server_find("");
+        assert(record);
+        strncpy(record->name, name, sizeof(record->name) - 1);
+    }
+    record->addr = dns_server_addr(addr);
+    record->ttl_s = ttl_s;
+}
+
+bool dns_server_answer(bool ok)
+{
+    if (query_count == 0)
+        return false;
+
+    dns_query_t query = queries[0];
+    memmove(queries, queries + 1, (size_t)(--query_count) * sizeof(queries[0]));
+
+    dns_record_t *record = dns_server_find(query.name);
+    if (!ok || !record)
+    {
+        query.found(query.name, NULL, query.arg);
+        return true;
+    }
+
+    record->cached = true;
+    record->cached_addr = record->addr;
+    record->expires_us = now_us + record->ttl_s * 1000000ull;
+    query.found(query.name, &record->cached_addr, query.arg);
+    return true;
+}
+
+int dns_server_pending(void)
+{
+    return query_count;
+}
+
+uint32_t dns_server_queries(void)
+{
+    return sent_queries;
+}
+
+void dns_server_fail_next_call(err_t err)
+{
+    next_error = err;
+}
+
+ip_addr_t dns_server_addr(const char *text)
+{
+    ip_addr_t addr = {0};
+    ipaddr_aton(text, &addr);
+    return addr;
+}
+
+err_t dns_gethostbyname(const char *hostname, ip_addr_t *addr, dns_found_callback found, void *callback_arg)
+{
+    if (next_error != ERR_OK)
+    {
+        err_t err = next_error;
+        next_error = ERR_OK;
+        return err;
+    }
+    if (!hostname || !hostname[0] || strlen(hostname) >= DNS_SERVER_NAME_MAX)
+        return ERR_ARG;
+
+    dns_record_t *record = dns_server_find(hostname);
+    if (record && record->cached && now_us < record->expires_us)
+    {
+        *addr = record->cached_addr;
+        return ERR_OK;
+    }
+
+    assert(query_count < DNS_SERVER_QUERIES);
+    dns_query_t *query = &queries[query_count++];
+    strcpy(query->name, hostname);
+    query->found = found;
+    query->arg = callback_arg;
+    sent_queries++;
+    return ERR_INPROGRESS;
+}
+
+int ipaddr_aton(const char *cp, ip_addr_t *addr)
+{
+    unsigned parts[4];
+    char tail;
+    if (sscanf(cp, "%u.%u.%u.%u%c", &parts[0], &parts[1], &parts[2], &parts[3], &tail) != 4)
+        return 0;
+    for (int i = 0; i < 4; ++i)
+        if (parts[i] > 255)
+            return 0;
+
+    addr->addr = parts[0] | parts[1] << 8 | parts[2] << 16 | (uint32_t)parts[3] << 24;
+    return 1;
+}
+
+char *ipaddr_ntoa(const ip_addr_t *addr)
+{
+    static char text[16];
+    snprintf(text, sizeof(text), "%u.%u.%u.%u", (unsigned)(addr->addr & 0xFF), (unsigned)(addr->addr >> 8 & 0xFF),
+             (unsigned)(addr->addr >> 16 & 0xFF), (unsigned)(addr->addr >> 24));
+    return text;
+}
@@ -0,0 +1,61 @@
+/**
+ * @file dns_server.h
+ * @brief Servidor DNS falso, com a tabela de respostas do lwIP na frente.
+ *
+ * Como no lwIP, dns_gethostbyname responde na hora enquanto dura o TTL do
+ * registro que está na tabela. Fora disso, ele abre uma consulta e responde
+ * depois, pelo callback. Aqui a resposta só chega quando o teste chama
+ * dns_server_answer(), com o endereço atual do nome ou com uma falha.
+ */
+
+#ifndef DNS_SERVER_H
+#define DNS_SERVER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "lwip/dns.h"
+
+/**
+ * @brief Esvazia a tabela e as consultas, apaga os registros e volta o relógio a zero.
+ */
+void dns_server_reset(void);
+
+/**
+ * @brief Avança o relógio simulado (time_us_64()).
+ */
+void dns_server_advance_us(uint64_t us);
+
+/**
+ * @brief Cria ou muda o registro de um nome no servidor (a tabela só vê a mudança na próxima consulta).
+ */
+void dns_server_set(const char *name, const char *addr, uint32_t ttl_s);
+
+/**
+ * @brief Responde a consulta mais antiga em aberto.
+ * @param ok false para uma falha (servidor mudo ou nome inexistente).
+ * @return false se não havia consulta em aberto.
+ */
+bool dns_server_answer(bool ok);
+
+/**
+ * @brief Consultas em aberto.
+ */
+int dns_server_pending(void);
+
+/**
+ * @brief Consultas enviadas ao servidor desde dns_server_reset().
+ */
+uint32_t dns_server_queries(void);
+
+/**
+ * @brief Faz a próxima chamada de dns_gethostbyname retornar `err` (ex.: ERR_MEM, tabela cheia).
+ */
+void dns_server_fail_next_call(err_t err);
+
+/**
+ * @brief Monta um endereço a partir do texto (para comparar com o do resolvedor).
+ */
+ip_addr_t dns_server_addr(const char *text);
+
+#endif
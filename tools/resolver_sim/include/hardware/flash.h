@@ -0,0 +1,12 @@
+/**
+ * @file flash.h
+ * @brief Tamanhos da flash usados por storage.h (o armazenamento em si é falso, em sim.c).
+ */
+
+#ifndef SIM_HARDWARE_FLASH_H
+#define SIM_HARDWARE_FLASH_H
+
+#define FLASH_PAGE_SIZE (1u << 8)
+#define FLASH_SECTOR_SIZE (1u << 12)
+
+#endif
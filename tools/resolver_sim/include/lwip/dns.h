@@ -0,0 +1,24 @@
+/**
+ * @file dns.h
+ * @brief dns_gethostbyname do lwIP, respondido pelo servidor DNS falso de dns.c.
+ */
+
+#ifndef SIM_LWIP_DNS_H
+#define SIM_LWIP_DNS_H
+
+#include <stdint.h>
+
+#include "lwip/ip_addr.h"
+
+typedef int8_t err_t;
+
+#define ERR_OK 0
+#define ERR_MEM -1
+#define ERR_INPROGRESS -5
+#define ERR_ARG -16
+
+typedef void (*dns_found_callback)(const char *name, const ip_addr_t *ipaddr, void *callback_arg);
+
+err_t dns_gethostbyname(const char *hostname, ip_addr_t *addr, dns_found_callback found, void *callback_arg);
+
+#endif
@@ -0,0 +1,22 @@
+/**
+ * @file ip_addr.h
+ * @brief Endereço IPv4 mínimo, no lugar do lwip/ip_addr.h (conversões em dns.c).
+ */
+
+#ifndef SIM_LWIP_IP_ADDR_H
+#define SIM_LWIP_IP_ADDR_H
+
+#include <stdint.h>
+
+typedef struct
+{
+    uint32_t addr; ///< Endereço em ordem de rede, como no lwIP (10.0.0.1 = 0x0100000a)
+} ip_addr_t;
+
+#define ip_addr_cmp(a, b) ((a)->addr == (b)->addr)
+#define ip_addr_copy(dest, src) ((dest) = (src))
+
+int ipaddr_aton(const char *cp, ip_addr_t *addr);
+char *ipaddr_ntoa(const ip_addr_t *addr);
+
+#endif
@@ -0,0 +1,21 @@
+/**
+ * @file stdlib.h
+ * @brief Subconjunto do pico/stdlib.h usado pelo resolvedor e pelo console, para compilação no host.
+ */
+
+#ifndef SIM_PICO_STDLIB_H
+#define SIM_PICO_STDLIB_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define PICO_ERROR_TIMEOUT -2
+
+/// Relógio simulado: só anda quando o teste manda (dns.c)
+uint64_t time_us_64(void);
+
+/// Entrada do console: os caracteres que o teste digitou (sim.c)
+int getchar_timeout_us(uint32_t timeout_us);
+
+#endif
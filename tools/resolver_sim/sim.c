@@ -0,0 +1,369 @@
+/**
+ * @file sim.c
+ * @brief Testes no host do endereço do servidor: resolvedor com cache (resolver.c),
+ *        registro na flash (server_config.c) e console serial (console.c).
+ *
+ * Uso: resolver_sim
+ *
+ * O DNS é o servidor falso de dns_server.c, o armazenamento na flash é um
+ * slot em memória e o console lê os caracteres que o teste digita.
+ *
+ * Retorna 1 se algum cenário falhar.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "pico/stdlib.h"
+
+#include "console.h"
+#include "dns_server.h"
+#include "resolver.h"
+#include "server_config.h"
+#include "drivers/storage.h"
+
+static int failures = 0;
+
+#define CHECK(cond, ...)                                                                                               \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        if (!(cond))                                                                                                   \
+        {                                                                                                              \
+            printf("  FALHA (%s:%d): ", __FILE__, __LINE__);                                                           \
+            printf(__VA_ARGS__);                                                                                       \
+            printf("\n");                                                                                              \
+            failures++;                                                                                                \
+        }                                                                                                              \
+    } while (0)
+
+/// Slots do armazenamento falso
+static uint8_t slots[STORAGE_SLOT_COUNT][STORAGE_MAX_RECORD_SIZE];
+static size_t slot_len[STORAGE_SLOT_COUNT];
+static bool storage_fails;
+
+/// Caracteres ainda não lidos pelo console
+static const char *typed = "";
+
+bool storage_load(uint8_t slot, void *data, size_t len)
+{
+    if (slot >= STORAGE_SLOT_COUNT || slot_len[slot] != len)
+        return false;
+    memcpy(data, slots[slot], len);
+    return true;
+}
+
+bool storage_save(uint8_t slot, const void *data, size_t len)
+{
+    if (storage_fails || slot >= STORAGE_SLOT_COUNT || len > STORAGE_MAX_RECORD_SIZE)
+        return false;
+    memcpy(slots[slot], data, len);
+    slot_len[slot] = len;
+    return true;
+}
+
+int getchar_timeout_us(uint32_t timeout_us)
+{
+    return *typed ? (unsigned char)*typed++ : PICO_ERROR_TIMEOUT;
+}
+
+/**
+ * @brief Confere o endereço em cache do resolvedor (NULL = nenhum).
+ */
+static void expect_address(const RESOLVER_T *resolver, const char *expected, int line)
+{
+    ip_addr_t addr;
+    bool resolved = resolver_address(resolver, &addr);
+    if (!expected && !resolved)
+        return;
+
+    char got[16] = "-";
+    if (resolved)
+        snprintf(got, sizeof(got), "%s", ipaddr_ntoa(&addr));
+    if (!expected || !resolved || addr.addr != dns_server_addr(expected).addr)
+    {
+        printf("  FALHA (linha %d): endereço %s, esperado %s\n", line, got, expected ? expected : "-");
+        failures++;
+    }
+}
+#define EXPECT_ADDRESS(resolver, expected) expect_address(resolver, expected, __LINE__)
+
+/**
+ * @brief Servidor DNS vazio e relógio em zero.
+ */
+static void start(const char *name)
+{
+    printf("%s\n", name);
+    dns_server_reset();
+}
+
+/**
+ * @brief Avança o relógio e chama resolver_poll, como o laço principal.
+ */
+static void poll_after(RESOLVER_T *resolver, uint64_t ms)
+{
+    dns_server_advance_us(ms * 1000);
+    resolver_poll(resolver, time_us_64());
+}
+
+/**
+ * @brief Um endereço com pontos não passa pelo DNS.
+ */
+static void scenario_literal(void)
+{
+    start("endereco_literal");
+    RESOLVER_T resolver;
+    resolver_init(&resolver, "192.168.0.7");
+
+    EXPECT_ADDRESS(&resolver, "192.168.0.7");
+    poll_after(&resolver, 0);
+    poll_after(&resolver, RESOLVER_REFRESH_MS * 3);
+    CHECK(dns_server_queries() == 0, "%lu consultas para um endereço literal", (unsigned long)dns_server_queries());
+    CHECK(resolver_next_event_us(&resolver) == UINT64_MAX, "endereço literal pediu para acordar");
+}
+
+/**
+ * @brief Primeira consulta: nenhum endereço até a resposta, sem consultas repetidas enquanto ela não chega.
+ */
+static void scenario_first_query(void)
+{
+    start("primeira_consulta");
+    dns_server_set("coletor.local", "10.0.0.1", 60);
+    RESOLVER_T resolver;
+    resolver_init(&resolver, "coletor.local");
+
+    EXPECT_ADDRESS(&resolver, NULL);
+    CHECK(resolver_next_event_us(&resolver) == 0, "primeira consulta não ficou para já");
+    poll_after(&resolver, 0);
+    CHECK(resolver.pending && dns_server_pending() == 1, "consulta não foi aberta");
+    CHECK(resolver_next_event_us(&resolver) == UINT64_MAX, "consulta em aberto pediu para acordar");
+
+    poll_after(&resolver, 100);
+    poll_after(&resolver, 1000);
+    CHECK(dns_server_queries() == 1, "%lu consultas enquanto a primeira não voltou",
+          (unsigned long)dns_server_queries());
+
+    dns_server_advance_us(20000);
+    dns_server_answer(true);
+    EXPECT_ADDRESS(&resolver, "10.0.0.1");
+    CHECK(!resolver.pending && resolver.queries == 1 && resolver.changes == 1, "pendente=%d consultas=%lu mudancas=%lu",
+          resolver.pending, (unsigned long)resolver.queries, (unsigned long)resolver.changes);
+    CHECK(resolver_next_event_us(&resolver) == time_us_64() + RESOLVER_REFRESH_MS * 1000ull,
+          "próxima consulta fora do intervalo de atualização");
+}
+
+/**
+ * @brief Atualizações periódicas: a tabela do lwIP responde enquanto dura o
+ *        TTL (60 s), e o servidor é consultado de novo quando ele acaba.
+ */
+static void scenario_ttl(void)
+{
+    start("ttl");
+    dns_server_set("coletor.local", "10.0.0.1", 60);
+    RESOLVER_T resolver;
+    resolver_init(&resolver, "coletor.local");
+    poll_after(&resolver, 0);
+    dns_server_answer(true);
+
+    for (int i = 0; i < 20; ++i)
+    { // 5 minutos, em passos de meio intervalo de atualização
+        poll_after(&resolver, RESOLVER_REFRESH_MS / 2);
+        if (dns_server_pending())
+            dns_server_answer(true);
+    }
+
+    // Atualizações em 30, 60, ..., 300 s: a tabela responde na de 30 s de cada TTL de 60 s
+    printf("  5 min: %lu respostas da tabela, %lu consultas ao servidor\n", (unsigned long)resolver.cache_hits,
+           (unsigned long)resolver.queries);
+    CHECK(resolver.cache_hits == 5 && resolver.queries == 5 + 1, "tabela=%lu consultas=%lu, esperado 5 e 6",
+          (unsigned long)resolver.cache_hits, (unsigned long)resolver.queries);
+    CHECK(resolver.changes == 1, "endereço igual contou como mudança");
+    EXPECT_ADDRESS(&resolver, "10.0.0.1");
+}
+
+/**
+ * @brief Uma consulta que falha mantém o endereço antigo até a nova tentativa, que encontra o servidor novo.
+ */
+static void scenario_failure_keeps_address(void)
+{
+    start("falha_mantem_endereco");
+    dns_server_set("coletor.local", "10.0.0.1", 1);
+    RESOLVER_T resolver;
+    resolver_init(&resolver, "coletor.local");
+    poll_after(&resolver, 0);
+    dns_server_answer(true);
+
+    dns_server_set("coletor.local", "10.0.0.2", 1); // O coletor mudou de máquina
+    poll_after(&resolver, RESOLVER_REFRESH_MS);
+    dns_server_answer(false);
+    EXPECT_ADDRESS(&resolver, "10.0.0.1");
+    CHECK(resolver.failures == 1 && !resolver.pending, "falhas=%lu pendente=%d", (unsigned long)resolver.failures,
+          resolver.pending);
+    CHECK(resolver_next_event_us(&resolver) == time_us_64() + RESOLVER_RETRY_MS * 1000ull,
+          "nova tentativa fora do intervalo de falha");
+
+    poll_after(&resolver, RESOLVER_RETRY_MS - 1);
+    CHECK(dns_server_pending() == 0, "tentou de novo antes do intervalo");
+    poll_after(&resolver, 1);
+    dns_server_answer(true);
+    EXPECT_ADDRESS(&resolver, "10.0.0.2");
+    CHECK(resolver.changes == 2, "mudancas=%lu, esperado 2", (unsigned long)resolver.changes);
+
+    // Erro na própria chamada (tabela do lwIP cheia): também espera o intervalo de falha
+    dns_server_fail_next_call(ERR_MEM);
+    poll_after(&resolver, RESOLVER_REFRESH_MS);
+    CHECK(!resolver.pending && resolver.failures == 2, "pendente=%d falhas=%lu", resolver.pending,
+          (unsigned long)resolver.failures);
+    CHECK(resolver_next_event_us(&resolver) == time_us_64() + RESOLVER_RETRY_MS * 1000ull,
+          "nova tentativa fora do intervalo de falha");
+    EXPECT_ADDRESS(&resolver, "10.0.0.2");
+}
+
+/**
+ * @brief Nome trocado com uma consulta em aberto: a resposta antiga chega
+ *        depois e é ignorada, e o nome novo é consultado na hora.
+ */
+static void scenario_stale_answer(void)
+{
+    start("resposta_atrasada");
+    dns_server_set("antigo.local", "10.0.0.1", 60);
+    dns_server_set("novo.local", "10.0.0.9", 60);
+    RESOLVER_T resolver;
+    resolver_init(&resolver, "antigo.local");
+    poll_after(&resolver, 0);
+
+    resolver_init(&resolver, "novo.local");
+    poll_after(&resolver, 0);
+    CHECK(dns_server_pending() == 2, "nome novo não foi consultado na hora");
+
+    dns_server_answer(true); // antigo.local
+    EXPECT_ADDRESS(&resolver, NULL);
+    CHECK(resolver.pending, "resposta antiga encerrou a consulta do nome novo");
+
+    dns_server_answer(true); // novo.local
+    EXPECT_ADDRESS(&resolver, "10.0.0.9");
+
+    // Trocar para um endereço literal também ignora uma resposta atrasada
+    poll_after(&resolver, RESOLVER_REFRESH_MS * 3);
+    resolver_init(&resolver, "172.16.0.5");
+    dns_server_answer(true);
+    EXPECT_ADDRESS(&resolver, "172.16.0.5");
+}
+
+/**
+ * @brief Registro do servidor: padrões sem flash, validação dos campos e ida e volta pela flash.
+ */
+static void scenario_config(void)
+{
+    printf("configuracao\n");
+    memset(slot_len, 0, sizeof(slot_len));
+
+    SERVER_CONFIG_T config;
+    CHECK(!server_config_load(&config), "carregou um registro de uma flash vazia");
+    CHECK(strcmp(config.host, SERVER_CONFIG_DEFAULT_HOST) == 0 && config.http_port == SERVER_CONFIG_DEFAULT_HTTP_PORT &&
+              config.udp_port == SERVER_CONFIG_DEFAULT_UDP_PORT && strcmp(config.path, SERVER_CONFIG_DEFAULT_PATH) == 0,
+          "padrões errados");
+
+    static const struct
+    {
+        const char *key;
+        const char *value;
+        bool valid;
+    } cases[] = {
+        {"host", "coletor-2.lab.local", true},
+        {"host", "10.0.0.1", true},
+        {"host", "", false},
+        {"host", "com espaco", false},
+        {"host", "ponto;virgula", false},
+        {"host", "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa", false}, // 64 caracteres
+        {"port", "8080", true},
+        {"port", "0", false},
+        {"port", "65536", false},
+        {"port", "80x", false},
+        {"port", "", false},
+        {"udp", "65535", true},
+        {"path", "/v2/leituras", true},
+        {"path", "sem/barra", false},
+        {"path", "/com espaco", false},
+        {"senha", "x", false},
+    };
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); ++i)
+    {
+        SERVER_CONFIG_T before = config;
+        bool valid = server_config_set(&config, cases[i].key, cases[i].value);
+        CHECK(valid == cases[i].valid, "%s \"%s\" %s", cases[i].key, cases[i].value,
+              valid ? "aceito" : "recusado");
+        if (!valid)
+            CHECK(memcmp(&before, &config, sizeof(config)) == 0, "%s inválido mudou o registro", cases[i].key);
+    }
+
+    CHECK(server_config_save(&config), "falha ao gravar");
+    SERVER_CONFIG_T loaded;
+    CHECK(server_config_load(&loaded), "registro gravado não foi carregado");
+    CHECK(strcmp(loaded.host, "10.0.0.1") == 0 && loaded.http_port == 8080 && loaded.udp_port == 65535 &&
+              strcmp(loaded.path, "/v2/leituras") == 0,
+          "registro carregado diferente do gravado");
+
+    // Registro de outra versão: volta aos padrões
+    slots[STORAGE_SLOT_SERVER][0] = SERVER_CONFIG_VERSION + 1;
+    CHECK(!server_config_load(&loaded) && strcmp(loaded.host, SERVER_CONFIG_DEFAULT_HOST) == 0,
+          "registro de outra versão foi aceito");
+
+    storage_fails = true;
+    CHECK(!server_config_save(&config), "falha de gravação não foi informada");
+    storage_fails = false;
+}
+
+/**
+ * @brief Console: linhas terminadas em CR, LF ou CRLF, backspace, linhas vazias e longas demais.
+ */
+static void scenario_console(void)
+{
+    printf("console\n");
+    CONSOLE_T console;
+    console_init(&console);
+
+    typed = "server host coletor.local\r\nserver port 8080\n";
+    const char *line = console_poll(&console);
+    CHECK(line && strcmp(line, "server host coletor.local") == 0, "primeira linha: %s", line ? line : "(nenhuma)");
+    line = console_poll(&console);
+    CHECK(line && strcmp(line, "server port 8080") == 0, "segunda linha: %s", line ? line : "(nenhuma)");
+    CHECK(console_poll(&console) == NULL, "linha vazia do CRLF foi entregue");
+
+    typed = "serx\bver\x7f\x7f\x7fver";
+    CHECK(console_poll(&console) == NULL, "linha entregue sem o fim de linha");
+    typed = "\r";
+    line = console_poll(&console);
+    CHECK(line && strcmp(line, "server") == 0, "backspace: %s", line ? line : "(nenhuma)");
+
+    char long_line[CONSOLE_LINE_MAX + 40];
+    memset(long_line, 'x', CONSOLE_LINE_MAX + 10);
+    strcpy(long_line + CONSOLE_LINE_MAX + 10, "\npm\n");
+    typed = long_line;
+    line = console_poll(&console);
+    CHECK(line && strcmp(line, "pm") == 0, "depois da linha longa: %s", line ? line : "(nenhuma)");
+
+    char longest[CONSOLE_LINE_MAX + 1];
+    memset(longest, 'y', CONSOLE_LINE_MAX - 1);
+    strcpy(longest + CONSOLE_LINE_MAX - 1, "\n");
+    typed = longest;
+    line = console_poll(&console);
+    CHECK(line && strlen(line) == CONSOLE_LINE_MAX - 1, "linha do tamanho máximo não foi entregue");
+}
+
+int main(void)
+{
+    scenario_literal();
+    scenario_first_query();
+    scenario_ttl();
+    scenario_failure_keeps_address();
+    scenario_stale_answer();
+    scenario_config();
+    scenario_console();
+
+    if (failures)
+        printf("\n%d falha(s)\n", failures);
+    else
+        printf("\nok\n");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,498 @@
+/**
+ * @file bench.c
+ * @brief Medições de desempenho das rotinas de desenho contra as versões anteriores.
+ */
+
+#include "bench.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "display.h"
+#include "wind_rose.h"
+
+/// Operações por rodada de medição
+#define BENCH_OPS 20000
+
+/// Sorteios da conferência entre a rotina rápida e a de referência
+#define BENCH_CHECKS 5000
+
+/// Maior erro de rumo aceito do CORDIC, em graus (o rumo publicado tem resolução de 0,1°)
+#define BENCH_MAX_HEADING_ERROR_DEG 0.25
+
+/// Erro de intensidade aceito do CORDIC: parte relativa (porcentagem) ...
+#define BENCH_MAX_MAGNITUDE_ERROR_PCT 0.05
+
+/// ... mais uma parte absoluta, para o arredondamento dos vetores curtos
+#define BENCH_MAX_MAGNITUDE_ERROR_UNITS 2.0
+
+static uint32_t bench_seed = 12345;
+
+/**
+ * @brief Gerador pseudoaleatório fixo, para que as medições sejam repetíveis.
+ */
+static uint32_t bench_rand(void)
+{
+    bench_seed = bench_seed * 1103515245u + 12345u;
+    return bench_seed >> 8;
+}
+
+static uint64_t bench_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+/**
+ * @brief Imprime uma linha da tabela: operações por segundo antes e depois.
+ */
+static void bench_report(const char *name, uint32_t ops, uint64_t before_ns, uint64_t after_ns)
+{
+    double before = ops * 1e9 / (double)(before_ns ? before_ns : 1);
+    double after = ops * 1e9 / (double)(after_ns ? after_ns : 1);
+    printf("%-20s %14.0f %14.0f %7.1fx\n", name, before, after, after / before);
+}
+
+/// Linha da versão anterior: inclinação em float, um pixel por coluna (com a troca de pontos corrigida)
+static void legacy_draw_line(ssd1306_t *p, int32_t x1, int32_t y1, int32_t x2, int32_t y2)
+{
+    if (x1 > x2)
+    {
+        int32_t t = x1;
+        x1 = x2;
+        x2 = t;
+        t = y1;
+        y1 = y2;
+        y2 = t;
+    }
+
+    if (x1 == x2)
+    {
+        if (y1 > y2)
+        {
+            int32_t t = y1;
+            y1 = y2;
+            y2 = t;
+        }
+        for (int32_t i = y1; i <= y2; ++i)
+            ssd1306_draw_pixel(p, x1, i);
+        return;
+    }
+
+    float m = (float)(y2 - y1) / (float)(x2 - x1);
+
+    for (int32_t i = x1; i <= x2; ++i)
+    {
+        float y = m * (float)(i - x1) + (float)y1;
+        ssd1306_draw_pixel(p, i, (uint32_t)y);
+    }
+}
+
+/// Retângulo da versão anterior: pixel a pixel
+static void legacy_fill_rect(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t width, uint32_t height, bool set)
+{
+    for (uint32_t i = 0; i < width; ++i)
+        for (uint32_t j = 0; j < height; ++j)
+        {
+            if (set)
+                ssd1306_draw_pixel(p, x + i, y + j);
+            else
+                ssd1306_clear_pixel(p, x + i, y + j);
+        }
+}
+
+/// Fonte padrão do driver (definida em ssd1306.c, a partir de font.h)
+extern const uint8_t font_8x5[];
+
+/// Caractere da versão anterior: um quadrado pixel a pixel para cada pixel aceso da fonte
+static void legacy_draw_char(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t scale, const uint8_t *font, char c)
+{
+    if (c < font[3] || c > font[4])
+        return;
+
+    uint32_t parts_per_line = (font[0] >> 3) + ((font[0] & 7) > 0);
+    for (uint8_t w = 0; w < font[1]; ++w)
+    {
+        uint32_t pp = (c - font[3]) * font[1] * parts_per_line + w * parts_per_line + 5;
+        for (uint32_t lp = 0; lp < parts_per_line; ++lp)
+        {
+            uint8_t line = font[pp];
+
+            for (int8_t j = 0; j < 8; ++j, line >>= 1)
+            {
+                if (line & 1)
+                    legacy_fill_rect(p, x + w * scale, y + ((lp << 3) + j) * scale, scale, scale, true);
+            }
+
+            ++pp;
+        }
+    }
+}
+
+/**
+ * @brief Sorteia um retângulo, às vezes parcialmente fora da tela ou com coordenada negativa.
+ */
+static void bench_random_rect(uint32_t *x, uint32_t *y, uint32_t *w, uint32_t *h)
+{
+    *x = bench_rand() % 150 - 10;
+    *y = bench_rand() % 80 - 8;
+    *w = bench_rand() % 70;
+    *h = bench_rand() % 40;
+}
+
+/**
+ * @brief Fundo aleatório com as janelas sujas zeradas.
+ */
+static void bench_random_background(uint8_t *background)
+{
+    for (size_t i = 0; i < display.bufsize; ++i)
+        background[i] = (uint8_t)bench_rand();
+}
+
+static void bench_load(const uint8_t *background)
+{
+    memcpy(display.buffer, background, display.bufsize);
+    memset(display.dirty_min, SSD1306_CLEAN, sizeof(display.dirty_min));
+    memset(display.dirty_max, 0, sizeof(display.dirty_max));
+}
+
+/**
+ * @brief Confere se o preenchimento por página pinta os mesmos pixels e marca as mesmas janelas que o pixel a pixel.
+ */
+static int bench_check_rects(void)
+{
+    uint8_t background[SSD1306_MAX_PAGES * 128];
+    uint8_t expected[sizeof(background)];
+    uint8_t expected_min[SSD1306_MAX_PAGES], expected_max[SSD1306_MAX_PAGES];
+    int failures = 0;
+
+    for (int n = 0; n < BENCH_CHECKS; ++n)
+    {
+        uint32_t x, y, w, h;
+        bool set = n & 1;
+        bench_random_rect(&x, &y, &w, &h);
+        bench_random_background(background);
+
+        bench_load(background);
+        legacy_fill_rect(&display, x, y, w, h, set);
+        memcpy(expected, display.buffer, display.bufsize);
+        memcpy(expected_min, display.dirty_min, sizeof(expected_min));
+        memcpy(expected_max, display.dirty_max, sizeof(expected_max));
+
+        bench_load(background);
+        if (set)
+            ssd1306_draw_square(&display, x, y, w, h);
+        else
+            ssd1306_clear_square(&display, x, y, w, h);
+
+        if (memcmp(expected, display.buffer, display.bufsize) != 0 ||
+            memcmp(expected_min, display.dirty_min, sizeof(expected_min)) != 0 ||
+            memcmp(expected_max, display.dirty_max, sizeof(expected_max)) != 0)
+        {
+            if (failures++ < 5)
+                printf("retangulo %s (%d, %d, %u, %u) difere do pixel a pixel\n", set ? "cheio" : "limpo", (int)x,
+                       (int)y, w, h);
+        }
+    }
+    return failures;
+}
+
+/**
+ * @brief Confere se cada linha Bresenham é contínua: cada passo anda um pixel, sem buracos.
+ */
+static int bench_check_lines(void)
+{
+    int failures = 0;
+
+    for (int n = 0; n < BENCH_CHECKS; ++n)
+    {
+        int32_t x1 = bench_rand() % 128, y1 = bench_rand() % 64;
+        int32_t x2 = bench_rand() % 128, y2 = bench_rand() % 64;
+        int32_t dx = x2 > x1 ? x2 - x1 : x1 - x2, dy = y2 > y1 ? y2 - y1 : y1 - y2;
+
+        ssd1306_clear(&display);
+        ssd1306_draw_line(&display, x1, y1, x2, y2);
+
+        // uma linha sem buracos acende exatamente um pixel por passo do eixo maior, incluindo as pontas
+        uint32_t lit = 0;
+        for (size_t i = 0; i < display.bufsize; ++i)
+            lit += __builtin_popcount(display.buffer[i]);
+        bool ends = display.buffer[x1 + 128 * (y1 >> 3)] & (1 << (y1 & 7)) &&
+                    display.buffer[x2 + 128 * (y2 >> 3)] & (1 << (y2 & 7));
+
+        if (lit != (uint32_t)(dx > dy ? dx : dy) + 1 || !ends)
+        {
+            if (failures++ < 5)
+                printf("linha (%d, %d)-(%d, %d): %u pixels, esperado %d\n", (int)x1, (int)y1, (int)x2, (int)y2, lit,
+                       (dx > dy ? dx : dy) + 1);
+        }
+    }
+    return failures;
+}
+
+int bench_graphics(void)
+{
+    int32_t lines[BENCH_OPS][4];
+    uint32_t rects[BENCH_OPS][4];
+    uint64_t start, before, after;
+
+    for (int i = 0; i < BENCH_OPS; ++i)
+    {
+        lines[i][0] = bench_rand() % 128;
+        lines[i][1] = bench_rand() % 64;
+        lines[i][2] = bench_rand() % 128;
+        lines[i][3] = bench_rand() % 64;
+        bench_random_rect(&rects[i][0], &rects[i][1], &rects[i][2], &rects[i][3]);
+    }
+
+    printf("%-20s %14s %14s %8s\n", "desenho", "antes (op/s)", "agora (op/s)", "ganho");
+
+    ssd1306_clear(&display);
+    start = bench_now_ns();
+    for (int i = 0; i < BENCH_OPS; ++i)
+        legacy_draw_line(&display, lines[i][0], lines[i][1], lines[i][2], lines[i][3]);
+    before = bench_now_ns() - start;
+    ssd1306_clear(&display);
+    start = bench_now_ns();
+    for (int i = 0; i < BENCH_OPS; ++i)
+        ssd1306_draw_line(&display, lines[i][0], lines[i][1], lines[i][2], lines[i][3]);
+    after = bench_now_ns() - start;
+    bench_report("linhas", BENCH_OPS, before, after);
+
+    // a versão anterior acende um pixel por coluna e deixa buracos nas linhas íngremes
+    uint64_t legacy_pixels = 0, pixels = 0;
+    for (int i = 0; i < BENCH_OPS; ++i)
+    {
+        int32_t dx = lines[i][2] - lines[i][0], dy = lines[i][3] - lines[i][1];
+        dx = dx < 0 ? -dx : dx;
+        dy = dy < 0 ? -dy : dy;
+        legacy_pixels += (dx ? dx : dy) + 1;
+        pixels += (dx > dy ? dx : dy) + 1;
+    }
+    printf("%-20s %14.1f %14.1f   pixels por linha\n", "", (double)legacy_pixels / BENCH_OPS,
+           (double)pixels / BENCH_OPS);
+
+    for (int set = 1; set >= 0; --set)
+    {
+        ssd1306_clear(&display);
+        start = bench_now_ns();
+        for (int i = 0; i < BENCH_OPS; ++i)
+        {
+            if (!set && i % 16 == 0)
+                memset(display.buffer, 0xFF, display.bufsize); // algo para limpar
+            legacy_fill_rect(&display, rects[i][0], rects[i][1], rects[i][2], rects[i][3], set);
+        }
+        before = bench_now_ns() - start;
+        ssd1306_clear(&display);
+        start = bench_now_ns();
+        for (int i = 0; i < BENCH_OPS; ++i)
+        {
+            if (!set && i % 16 == 0)
+                memset(display.buffer, 0xFF, display.bufsize);
+            if (set)
+                ssd1306_draw_square(&display, rects[i][0], rects[i][1], rects[i][2], rects[i][3]);
+            else
+                ssd1306_clear_square(&display, rects[i][0], rects[i][1], rects[i][2], rects[i][3]);
+        }
+        after = bench_now_ns() - start;
+        bench_report(set ? "retangulos cheios" : "retangulos limpos", BENCH_OPS, before, after);
+    }
+
+    int failures = bench_check_rects() + bench_check_lines();
+    ssd1306_clear(&display);
+    return failures;
+}
+
+/**
+ * @brief Confere se o desenho por colunas acende os mesmos pixels e marca as mesmas janelas que o antigo.
+ */
+static int bench_check_glyphs(void)
+{
+    uint8_t background[SSD1306_MAX_PAGES * 128];
+    uint8_t expected[sizeof(background)];
+    uint8_t expected_min[SSD1306_MAX_PAGES], expected_max[SSD1306_MAX_PAGES];
+    int failures = 0;
+
+    for (int n = 0; n < BENCH_CHECKS; ++n)
+    {
+        char c = (char)(font_8x5[3] + bench_rand() % (font_8x5[4] - font_8x5[3] + 1));
+        uint32_t scale = 1 + bench_rand() % 4;
+        uint32_t x = bench_rand() % 140 - 8, y = bench_rand() % 76 - 8; // inclui bordas e coordenadas negativas
+        bench_random_background(background);
+
+        bench_load(background);
+        legacy_draw_char(&display, x, y, scale, font_8x5, c);
+        memcpy(expected, display.buffer, display.bufsize);
+        memcpy(expected_min, display.dirty_min, sizeof(expected_min));
+        memcpy(expected_max, display.dirty_max, sizeof(expected_max));
+
+        bench_load(background);
+        ssd1306_draw_char(&display, x, y, scale, c);
+
+        if (memcmp(expected, display.buffer, display.bufsize) != 0 ||
+            memcmp(expected_min, display.dirty_min, sizeof(expected_min)) != 0 ||
+            memcmp(expected_max, display.dirty_max, sizeof(expected_max)) != 0)
+        {
+            if (failures++ < 5)
+                printf("caractere '%c' escala %u em (%d, %d) difere do desenho antigo\n", c, scale, (int)x, (int)y);
+        }
+    }
+    return failures;
+}
+
+int bench_glyphs(void)
+{
+    static const struct
+    {
+        const char *name;
+        uint32_t scale;
+        uint32_t y_offset; ///< Deslocamento dentro da página (0 = alinhado)
+    } cases[] = {
+        {"texto x1 alinhado", 1, 0},
+        {"texto x1 desalinhado", 1, 3},
+        {"texto x2", 2, 5},
+        {"texto x3", 3, 1},
+    };
+    const char text[] = "N 359.9 NNE 12.34C";
+    const uint32_t len = sizeof(text) - 1;
+    const uint32_t rounds = BENCH_OPS / len;
+
+    printf("\n%-20s %14s %14s %8s\n", "fonte 8x5", "antes (car/s)", "agora (car/s)", "ganho");
+
+    for (size_t k = 0; k < sizeof(cases) / sizeof(cases[0]); ++k)
+    {
+        uint32_t scale = cases[k].scale;
+        uint32_t step = (font_8x5[1] + font_8x5[2]) * scale;
+        uint64_t start, before, after;
+
+        ssd1306_clear(&display);
+        start = bench_now_ns();
+        for (uint32_t r = 0; r < rounds; ++r)
+        {
+            uint32_t y = (r % 4) * 16 % (64 - 8 * scale) + cases[k].y_offset;
+            memset(display.buffer, 0, display.bufsize); // cada rodada desenha sobre a tela apagada
+            for (uint32_t i = 0; i < len; ++i)
+                legacy_draw_char(&display, (i * step) % 128, y, scale, font_8x5, text[i]);
+        }
+        before = bench_now_ns() - start;
+
+        ssd1306_clear(&display);
+        start = bench_now_ns();
+        for (uint32_t r = 0; r < rounds; ++r)
+        {
+            uint32_t y = (r % 4) * 16 % (64 - 8 * scale) + cases[k].y_offset;
+            memset(display.buffer, 0, display.bufsize); // cada rodada desenha sobre a tela apagada
+            for (uint32_t i = 0; i < len; ++i)
+                ssd1306_draw_char(&display, (i * step) % 128, y, scale, text[i]);
+        }
+        after = bench_now_ns() - start;
+
+        bench_report(cases[k].name, rounds * len, before, after);
+    }
+
+    int failures = bench_check_glyphs();
+    ssd1306_clear(&display);
+    return failures;
+}
+
+int bench_wind_rose(void)
+{
+    static int16_t xs[BENCH_OPS], ys[BENCH_OPS];
+    double max_heading = 0, sum_heading = 0, max_magnitude = 0, sum_magnitude = 0, max_units = 0;
+    uint32_t samples = 0, magnitude_failures = 0;
+
+    // precisão: grade que cobre toda a faixa do joystick, nos quatro quadrantes e sobre os eixos
+    for (int32_t x = -32767; x <= 32767; x += 257)
+    {
+        for (int32_t y = -32767; y <= 32767; y += 257)
+        {
+            if (!x && !y)
+                continue;
+
+            wind_rose_polar_t polar;
+            wind_rose_polar((int16_t)x, (int16_t)y, &polar);
+
+            double heading = atan2((double)x, (double)y) * 180.0 / M_PI;
+            if (heading < 0)
+                heading += 360.0;
+            double error = fabs(polar.angle * 360.0 / 65536.0 - heading);
+            if (error > 180.0)
+                error = 360.0 - error;
+
+            double exact = hypot((double)x, (double)y);
+            double units = fabs(polar.magnitude - exact);
+            double magnitude_error = units * 100.0 / exact;
+            if (units > BENCH_MAX_MAGNITUDE_ERROR_UNITS + exact * BENCH_MAX_MAGNITUDE_ERROR_PCT / 100.0)
+                magnitude_failures++;
+            max_units = units > max_units ? units : max_units;
+
+            max_heading = error > max_heading ? error : max_heading;
+            max_magnitude = magnitude_error > max_magnitude ? magnitude_error : max_magnitude;
+            sum_heading += error;
+            sum_magnitude += magnitude_error;
+            samples++;
+        }
+    }
+
+    printf("\nrosa dos ventos: %u vetores, erro de rumo medio %.4f / max %.4f graus, "
+           "erro de intensidade medio %.4f%% / max %.4f%% (%.2f unidades)\n",
+           samples, sum_heading / samples, max_heading, sum_magnitude / samples, max_magnitude, max_units);
+
+    int failures = 0;
+    if (max_heading > BENCH_MAX_HEADING_ERROR_DEG)
+    {
+        printf("erro de rumo acima de %.2f graus\n", BENCH_MAX_HEADING_ERROR_DEG);
+        failures++;
+    }
+    if (magnitude_failures)
+    {
+        printf("%u vetores com erro de intensidade acima de %.2f%% + %.0f unidades\n", magnitude_failures,
+               BENCH_MAX_MAGNITUDE_ERROR_PCT, BENCH_MAX_MAGNITUDE_ERROR_UNITS);
+        failures++;
+    }
+
+    // velocidade: os mesmos vetores pelos dois caminhos
+    for (int i = 0; i < BENCH_OPS; ++i)
+    {
+        xs[i] = (int16_t)(bench_rand() % 65535 - 32767);
+        ys[i] = (int16_t)(bench_rand() % 65535 - 32767);
+    }
+
+    volatile float float_sink = 0;
+    volatile uint32_t fixed_sink = 0;
+    uint64_t start, before, after;
+    const int rounds = 20;
+
+    start = bench_now_ns();
+    for (int r = 0; r < rounds; ++r)
+    {
+        float acc = 0;
+        for (int i = 0; i < BENCH_OPS; ++i)
+            acc += atan2f((float)xs[i], (float)ys[i]) + hypotf((float)xs[i], (float)ys[i]);
+        float_sink = acc;
+    }
+    before = bench_now_ns() - start;
+
+    start = bench_now_ns();
+    for (int r = 0; r < rounds; ++r)
+    {
+        uint32_t acc = 0;
+        for (int i = 0; i < BENCH_OPS; ++i)
+        {
+            wind_rose_polar_t polar;
+            wind_rose_polar(xs[i], ys[i], &polar);
+            acc += polar.angle + polar.magnitude;
+        }
+        fixed_sink = acc;
+    }
+    after = bench_now_ns() - start;
+    (void)float_sink;
+    (void)fixed_sink;
+
+    printf("%-20s %14s %14s %8s\n", "", "atan2f+hypotf", "CORDIC", "ganho");
+    bench_report("vetores/s", (uint32_t)rounds * BENCH_OPS, before, after);
+    return failures;
+}
@@ -0,0 +1,34 @@
+/**
+ * @file bench.h
+ * @brief Medições de desempenho no host: as rotinas de desenho do firmware
+ *        contra as versões anteriores, que ficam aqui como referência.
+ *
+ * Cada medição também confere se a rotina rápida produz o mesmo resultado que
+ * a de referência, quando as duas devem coincidir.
+ */
+
+#ifndef BENCH_H
+#define BENCH_H
+
+/**
+ * @brief Linhas e retângulos: Bresenham e preenchimento por página contra o desenho pixel a pixel.
+ *
+ * @return Quantidade de divergências encontradas.
+ */
+int bench_graphics(void);
+
+/**
+ * @brief Caracteres da fonte 8x5: colunas por byte e glifos pré-expandidos contra quadrados por pixel da fonte.
+ *
+ * @return Quantidade de divergências encontradas.
+ */
+int bench_glyphs(void);
+
+/**
+ * @brief Rumo e intensidade do joystick: CORDIC em ponto fixo contra atan2f/hypotf.
+ *
+ * @return Quantidade de limites de erro ultrapassados.
+ */
+int bench_wind_rose(void);
+
+#endif
@@ -0,0 +1,4 @@
+/**
+ * @file adc.h
+ * @brief Vazio no host: os cabeçalhos dos drivers o incluem, mas o simulador não usa o ADC.
+ */
@@ -0,0 +1,4 @@
+/**
+ * @file binary_info.h
+ * @brief Vazio no host: o driver do display só o inclui.
+ */
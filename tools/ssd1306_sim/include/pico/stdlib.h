@@ -0,0 +1,29 @@
+/**
+ * @file stdlib.h
+ * @brief Subconjunto do pico/stdlib.h usado pelo driver do display, para compilação no host.
+ */
+
+#ifndef SIM_PICO_STDLIB_H
+#define SIM_PICO_STDLIB_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define PICO_OK 0
+#define PICO_ERROR_GENERIC -1
+#define PICO_ERROR_TIMEOUT -2
+
+#define GPIO_FUNC_I2C 3
+
+typedef unsigned int uint;
+
+uint64_t time_us_64(void);
+void gpio_set_function(uint gpio, int fn);
+void gpio_pull_up(uint gpio);
+
+static inline void tight_loop_contents(void)
+{
+}
+
+#endif
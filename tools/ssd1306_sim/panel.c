@@ -0,0 +1,206 @@
+#include "panel.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "hardware/i2c.h"
+
+i2c_inst_t i2c1_inst = {1};
+
+/// GDDRAM do controlador
+static uint8_t ram[PANEL_PAGES][PANEL_WIDTH];
+
+/// Janela de endereçamento e ponteiro de escrita (modo horizontal)
+static uint8_t col_start, col_end, page_start, page_end, col, page;
+
+/// Estado de exibição
+static bool display_on, inverted;
+
+/// Comando em decodificação e seus argumentos
+static uint8_t cmd, args[2], args_needed, args_got;
+static bool in_cmd;
+
+static panel_traffic_t traffic;
+
+/**
+ * @brief Quantidade de argumentos de cada comando usado pelo driver.
+ */
+static uint8_t command_args(uint8_t c)
+{
+    switch (c)
+    {
+    case 0x21: // SET_COL_ADDR
+    case 0x22: // SET_PAGE_ADDR
+        return 2;
+    case 0x20: // SET_MEM_ADDR
+    case 0x81: // SET_CONTRAST
+    case 0x8D: // SET_CHARGE_PUMP
+    case 0xA8: // SET_MUX_RATIO
+    case 0xD3: // SET_DISP_OFFSET
+    case 0xD5: // SET_DISP_CLK_DIV
+    case 0xD9: // SET_PRECHARGE
+    case 0xDA: // SET_COM_PIN_CFG
+    case 0xDB: // SET_VCOM_DESEL
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+static void execute_command(void)
+{
+    switch (cmd)
+    {
+    case 0x21:
+        col_start = col = args[0] % PANEL_WIDTH;
+        col_end = args[1] % PANEL_WIDTH;
+        break;
+    case 0x22:
+        page_start = page = args[0] % PANEL_PAGES;
+        page_end = args[1] % PANEL_PAGES;
+        break;
+    case 0xA6:
+    case 0xA7:
+        inverted = cmd & 1;
+        break;
+    case 0xAE:
+    case 0xAF:
+        display_on = cmd & 1;
+        break;
+    default:
+        break;
+    }
+}
+
+static void command_byte(uint8_t b)
+{
+    if (!in_cmd)
+    {
+        cmd = b;
+        args_needed = command_args(b);
+        args_got = 0;
+        in_cmd = true;
+    }
+    else
+    {
+        args[args_got++] = b;
+    }
+
+    if (args_got == args_needed)
+    {
+        execute_command();
+        in_cmd = false;
+    }
+}
+
+static void data_byte(uint8_t b)
+{
+    ram[page][col] = b;
+    traffic.data_bytes++;
+
+    if (col++ == col_end)
+    {
+        col = col_start;
+        page = page == page_end ? page_start : page + 1;
+    }
+}
+
+void panel_reset(void)
+{
+    memset(ram, 0, sizeof(ram));
+    col_start = col = 0;
+    col_end = PANEL_WIDTH - 1;
+    page_start = page = 0;
+    page_end = PANEL_PAGES - 1;
+    display_on = false;
+    inverted = false;
+    in_cmd = false;
+    memset(&traffic, 0, sizeof(traffic));
+}
+
+uint i2c_init(i2c_inst_t *i2c, uint baudrate)
+{
+    (void)i2c;
+    return baudrate;
+}
+
+int i2c_write_blocking(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src, size_t len, bool nostop)
+{
+    (void)i2c;
+    (void)addr;
+    (void)nostop;
+
+    traffic.bytes += len + 1; // endereço + conteúdo
+    traffic.transactions++;
+
+    // primeiro byte: controle (0x00 = comandos, 0x40 = dados), com Co = 0
+    for (size_t i = 1; i < len; ++i)
+    {
+        if (src[0] & 0x40)
+            data_byte(src[i]);
+        else
+            command_byte(src[i]);
+    }
+    return (int)len;
+}
+
+uint64_t time_us_64(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000u + ts.tv_nsec / 1000;
+}
+
+void gpio_set_function(uint gpio, int fn)
+{
+    (void)gpio;
+    (void)fn;
+}
+
+void gpio_pull_up(uint gpio)
+{
+    (void)gpio;
+}
+
+bool panel_pixel(uint32_t x, uint32_t y)
+{
+    if (!display_on || x >= PANEL_WIDTH || y >= PANEL_PAGES * 8)
+        return false;
+
+    bool lit = (ram[y >> 3][x] >> (y & 7)) & 1;
+    return lit != inverted;
+}
+
+const uint8_t *panel_ram(void)
+{
+    return &ram[0][0];
+}
+
+bool panel_write_pbm(const char *path)
+{
+    FILE *f = fopen(path, "wb");
+    if (!f)
+        return false;
+
+    fprintf(f, "P4\n%d %d\n", PANEL_WIDTH, PANEL_PAGES * 8);
+    for (uint32_t y = 0; y < PANEL_PAGES * 8; ++y)
+    {
+        for (uint32_t x = 0; x < PANEL_WIDTH; x += 8)
+        {
+            uint8_t bits = 0;
+            for (uint32_t i = 0; i < 8; ++i)
+                bits |= !panel_pixel(x + i, y) << (7 - i); // PBM: 1 = preto; pixel aceso fica branco, como no OLED
+            fputc(bits, f);
+        }
+    }
+
+    return fclose(f) == 0;
+}
+
+panel_traffic_t panel_take_traffic(void)
+{
+    panel_traffic_t t = traffic;
+    memset(&traffic, 0, sizeof(traffic));
+    return t;
+}
@@ -0,0 +1,62 @@
+/**
+ * @file panel.h
+ * @brief Painel SSD1306 virtual de 128x64 alimentado pelas escritas I2C do driver.
+ *
+ * Decodifica o fluxo de comandos (endereçamento de colunas e páginas, liga/desliga,
+ * inversão) e os dados da GDDRAM exatamente como chegariam ao controlador, de
+ * modo que a imagem reflete o que o display mostraria, e não o framebuffer.
+ */
+
+#ifndef PANEL_H
+#define PANEL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/// Largura do painel em pixels
+#define PANEL_WIDTH 128
+
+/// Páginas (linhas de 8 pixels) do painel
+#define PANEL_PAGES 8
+
+/**
+ * @brief Contadores de tráfego I2C.
+ */
+typedef struct
+{
+    uint32_t bytes;        ///< Bytes no barramento (endereço incluído)
+    uint32_t transactions; ///< Transações (START ... STOP)
+    uint32_t data_bytes;   ///< Bytes gravados na GDDRAM
+} panel_traffic_t;
+
+/**
+ * @brief Apaga a GDDRAM virtual e reinicia o estado do controlador.
+ */
+void panel_reset(void);
+
+/**
+ * @brief Lê um pixel do painel virtual.
+ *
+ * @return true se o pixel estiver aceso (considerando inversão e display desligado).
+ */
+bool panel_pixel(uint32_t x, uint32_t y);
+
+/**
+ * @brief Conteúdo bruto da GDDRAM virtual (PANEL_PAGES linhas de PANEL_WIDTH bytes).
+ */
+const uint8_t *panel_ram(void);
+
+/**
+ * @brief Grava a imagem do painel em formato PBM (P4).
+ *
+ * @param path Caminho do arquivo.
+ * @return true em caso de sucesso.
+ */
+bool panel_write_pbm(const char *path);
+
+/**
+ * @brief Retorna e zera os contadores de tráfego acumulados desde a última chamada.
+ */
+panel_traffic_t panel_take_traffic(void);
+
+#endif
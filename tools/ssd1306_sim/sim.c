@@ -0,0 +1,348 @@
+/**
+ * @file sim.c
+ * @brief Simulador do display no host: desenha cenários com o código real do
+ *        firmware, confere o painel virtual e mede o custo de cada quadro.
+ *
+ * Uso: ssd1306_sim [-o <dir>] [-c <dir>] [-b]
+ *   -o <dir>  grava o último quadro de cada cenário em <dir>/<cenário>.pbm
+ *   -c <dir>  compara cada quadro final com <dir>/<cenário>.pbm (imagens de referência)
+ *   -b        em vez dos cenários, mede as rotinas de desenho, de texto e da rosa dos ventos (bench.c)
+ *
+ * Retorna 1 se o painel divergir do framebuffer ou de uma imagem de referência,
+ * ou se uma rotina medida divergir da sua referência.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "bench.h"
+#include "panel.h"
+#include "display.h"
+#include "compass.h"
+
+/// Frequência do barramento I2C do display (bits por segundo)
+#define SIM_I2C_HZ DISPLAY_FREQUENCY
+
+/// Bits por byte no barramento (8 de dados + ACK)
+#define SIM_BITS_PER_BYTE 9
+
+/// Bits extras por transação (START + STOP)
+#define SIM_BITS_PER_TRANSACTION 2
+
+/**
+ * @brief Resultado acumulado de um cenário.
+ */
+typedef struct
+{
+    const char *name;      ///< Nome do cenário (também nome da imagem)
+    uint32_t frames;       ///< Quadros enviados
+    uint64_t bytes;        ///< Bytes no barramento
+    uint64_t transactions; ///< Transações I2C
+    uint64_t cpu_us;       ///< Tempo de CPU gasto desenhando e preparando os quadros
+} scenario_t;
+
+static const char *output_dir = NULL;
+static const char *reference_dir = NULL;
+static int failures = 0;
+
+/**
+ * @brief Envia o quadro atual e acumula seu custo.
+ */
+static void frame(scenario_t *s, uint64_t start_us)
+{
+    display_flush();
+    s->cpu_us += time_us_64() - start_us;
+
+    panel_traffic_t t = panel_take_traffic();
+    s->frames++;
+    s->bytes += t.bytes;
+    s->transactions += t.transactions;
+
+    if (memcmp(panel_ram(), display.buffer, PANEL_PAGES * PANEL_WIDTH) != 0)
+    {
+        printf("%s: quadro %u difere do framebuffer\n", s->name, s->frames);
+        failures++;
+    }
+}
+
+/**
+ * @brief Compara o painel com a imagem de referência do cenário.
+ */
+static void check_reference(const scenario_t *s)
+{
+    char path[256], tmp[256];
+    snprintf(path, sizeof(path), "%s/%s.pbm", reference_dir, s->name);
+    snprintf(tmp, sizeof(tmp), "/tmp/ssd1306_sim_%d.pbm", (int)getpid());
+
+    if (!panel_write_pbm(tmp))
+        return;
+
+    FILE *a = fopen(path, "rb"), *b = fopen(tmp, "rb");
+    bool same = a && b;
+    while (same)
+    {
+        int ca = fgetc(a), cb = fgetc(b);
+        if (ca != cb)
+            same = false;
+        if (ca == EOF || cb == EOF)
+            break;
+    }
+    if (a)
+        fclose(a);
+    if (b)
+        fclose(b);
+    remove(tmp);
+
+    if (!a)
+    {
+        printf("%s: imagem de referência %s ausente\n", s->name, path);
+        failures++;
+    }
+    else if (!same)
+    {
+        printf("%s: imagem difere de %s\n", s->name, path);
+        failures++;
+    }
+}
+
+/**
+ * @brief Imprime o custo médio por quadro e grava/compara a imagem final.
+ */
+static void report(const scenario_t *s)
+{
+    uint64_t bits = s->bytes * SIM_BITS_PER_BYTE + s->transactions * SIM_BITS_PER_TRANSACTION;
+    uint32_t n = s->frames ? s->frames : 1;
+
+    printf("%-16s %6u %10.1f %8.1f %10.3f %9.2f\n", s->name, s->frames,
+           (double)s->bytes / n, (double)s->transactions / n,
+           (double)bits * 1000.0 / SIM_I2C_HZ / n, (double)s->cpu_us / n);
+
+    if (output_dir)
+    {
+        char path[256];
+        snprintf(path, sizeof(path), "%s/%s.pbm", output_dir, s->name);
+        if (!panel_write_pbm(path))
+            printf("%s: falha ao gravar %s\n", s->name, path);
+    }
+    if (reference_dir)
+        check_reference(s);
+}
+
+/// Tela de rede como a montada por show_connection_status
+static void status_screen(const char *ip)
+{
+    static int ip_field = -1;
+
+    if (display_screen_begin(1))
+    {
+        display_label(0, 0, "-=-REDE-=-=");
+        display_label(0, 16, "MinhaRede");
+        display_label(0, 32, "senha1234");
+        ip_field = display_field(0, 6, SCREEN_WIDTH, &font_small, TEXT_ALIGN_LEFT);
+    }
+    display_field_set(ip_field, ip);
+}
+
+static void scenario_status(void)
+{
+    scenario_t s = {.name = "status"};
+    const char *ips[] = {"IP: 192.168.0.10", "IP: 192.168.0.10", "IP: 192.168.0.11", "IP: 10.0.0.7"};
+
+    for (size_t i = 0; i < 60; ++i)
+    {
+        uint64_t start = time_us_64();
+        status_screen(ips[(i / 15) % 4]);
+        frame(&s, start);
+    }
+    report(&s);
+}
+
+static void scenario_full_redraw(void)
+{
+    scenario_t s = {.name = "full_redraw"};
+
+    // desenho antigo da tela de rede: limpa tudo e redesenha todas as linhas a cada atualização
+    for (size_t i = 0; i < 60; ++i)
+    {
+        uint64_t start = time_us_64();
+        clear_display(true);
+        show("-=-REDE-=-=", false);
+        show("MinhaRede", false);
+        show("senha1234", false);
+        show("IP: 192.168.0.10", false);
+        ssd1306_mark_all_dirty(&display);
+        frame(&s, start);
+    }
+    report(&s);
+}
+
+static void scenario_compass(void)
+{
+    scenario_t s = {.name = "compass"};
+
+    // uma volta completa do joystick em 3 s a 30 quadros por segundo
+    for (uint32_t i = 0; i <= 90; ++i)
+    {
+        compass_view_t view = {
+            .heading = (uint16_t)(i * 40 % 3600),
+            .magnitude = (uint16_t)(16000 + (i % 10) * 1000),
+            .direction = (wind_rose_dir_t)(((i * 40 + 112) / 225) % WIND_ROSE_POINTS),
+            .button_a = (i / 15) & 1,
+            .button_b = false,
+        };
+        uint64_t start = time_us_64();
+        compass_show(2, &view);
+        frame(&s, start);
+    }
+    report(&s);
+}
+
+static void scenario_compass_idle(void)
+{
+    scenario_t s = {.name = "compass_idle"};
+    compass_view_t view = {.heading = 0, .magnitude = 0, .direction = WIND_ROSE_CENTER};
+
+    for (uint32_t i = 0; i < 30; ++i)
+    {
+        uint64_t start = time_us_64();
+        compass_show(2, &view);
+        frame(&s, start);
+    }
+    report(&s);
+}
+
+static void scenario_lines(void)
+{
+    scenario_t s = {.name = "lines"};
+    uint64_t start = time_us_64();
+
+    ssd1306_clear(&display);
+
+    // leque no quadrado da esquerda: inclinações de 0 a 90° nos quatro quadrantes, metade delas desenhada de trás para frente
+    for (int32_t i = 0; i < 16; ++i)
+    {
+        int32_t k = i * 4;
+        int32_t ends[4][2] = {{k, 0}, {63, k}, {63 - k, 63}, {0, 63 - k}};
+        for (int32_t e = 0; e < 4; ++e)
+        {
+            if ((i + e) & 1)
+                ssd1306_draw_line(&display, ends[e][0], ends[e][1], 32, 32);
+            else
+                ssd1306_draw_line(&display, 32, 32, ends[e][0], ends[e][1]);
+        }
+    }
+
+    // à direita: quadrados vazados aninhados e linhas que saem da tela (recortadas)
+    for (uint32_t i = 0; i < 5; ++i)
+        ssd1306_draw_empty_square(&display, 68 + i * 5, 4 + i * 5, 54 - i * 10, 54 - i * 10);
+    ssd1306_draw_line(&display, 60, -10, 140, 70);
+    ssd1306_draw_line(&display, 140, 0, 60, 63);
+    ssd1306_draw_line(&display, 66, 62, 127, 61);
+
+    frame(&s, start);
+    report(&s);
+}
+
+static void scenario_rects(void)
+{
+    scenario_t s = {.name = "rects"};
+    uint64_t start = time_us_64();
+
+    ssd1306_clear(&display);
+
+    ssd1306_draw_square(&display, 2, 2, 20, 4);   // dentro de uma página
+    ssd1306_draw_square(&display, 2, 10, 20, 21);  // páginas parciais em cima e embaixo
+    ssd1306_draw_square(&display, 26, 0, 20, 64);  // altura inteira
+    ssd1306_draw_square(&display, 50, 8, 10, 8);   // alinhado a uma página
+    ssd1306_draw_square(&display, 62, 3, 1, 1);    // um pixel
+    ssd1306_draw_square(&display, 66, 5, 58, 50);  // bloco com um furo e uma ilha dentro
+    ssd1306_clear_square(&display, 76, 15, 38, 29);
+    ssd1306_draw_square(&display, 86, 23, 18, 11);
+    ssd1306_draw_square(&display, 120, 56, 30, 30);              // recortado na borda
+    ssd1306_draw_square(&display, (uint32_t)-5, 40, 12, 6);      // coordenada negativa
+    ssd1306_clear_square(&display, 30, (uint32_t)-4, 4, 12);     // limpa acima do topo
+    ssd1306_clear_square(&display, 2, 20, 20, 1);                // uma linha
+    ssd1306_draw_square(&display, 50, 40, 0, 10);                // vazio: nada muda
+
+    frame(&s, start);
+    report(&s);
+}
+
+static void scenario_compositor(void)
+{
+    // desenha a 1 kHz por 500 ms; o compositor deve apresentar no máximo DISPLAY_MAX_FPS quadros por segundo
+    display_stats_t before = *display_get_stats();
+    uint64_t end = time_us_64() + 500000;
+    uint32_t draws = 0;
+
+    while (time_us_64() < end)
+    {
+        compass_view_t view = {
+            .heading = (uint16_t)(draws * 7 % 3600),
+            .magnitude = 20000,
+            .direction = (wind_rose_dir_t)((draws * 7 + 112) / 225 % WIND_ROSE_POINTS),
+        };
+        compass_show(2, &view);
+        display_tick();
+        ssd1306_flush_wait(&display);
+        panel_take_traffic();
+        draws++;
+        usleep(1000);
+    }
+
+    const display_stats_t *after = display_get_stats();
+    printf("\ncompositor: %u desenhos em 500 ms -> %u quadros, %u adiados, %u sem mudancas, ultimo quadro %u us\n",
+           draws, after->presented - before.presented, after->deferred - before.deferred,
+           after->skipped - before.skipped, after->frame_us);
+}
+
+int main(int argc, char **argv)
+{
+    int opt;
+    bool bench = false;
+    while ((opt = getopt(argc, argv, "o:c:b")) != -1)
+    {
+        if (opt == 'o')
+            output_dir = optarg;
+        else if (opt == 'c')
+            reference_dir = optarg;
+        else if (opt == 'b')
+            bench = true;
+        else
+        {
+            fprintf(stderr, "uso: %s [-o <dir>] [-c <dir>] [-b]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    panel_reset();
+    if (init_display() != PICO_OK)
+        return 1;
+    ssd1306_flush_wait(&display);
+
+    if (bench)
+    {
+        failures = bench_graphics() + bench_glyphs() + bench_wind_rose();
+        if (failures)
+            printf("\n%d falha(s)\n", failures);
+        return failures ? 1 : 0;
+    }
+
+    panel_traffic_t init = panel_take_traffic();
+    printf("init: %u bytes em %u transacoes\n\n", init.bytes, init.transactions);
+
+    printf("%-16s %6s %10s %8s %10s %9s\n", "cenario", "quadros", "bytes/q", "trans/q", "I2C ms/q", "CPU us/q");
+    scenario_full_redraw();
+    scenario_status();
+    scenario_compass();
+    scenario_compass_idle();
+    scenario_lines();
+    scenario_rects();
+    scenario_compositor();
+
+    if (failures)
+        printf("\n%d falha(s)\n", failures);
+    return failures ? 1 : 0;
+}